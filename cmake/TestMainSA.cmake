@@ -7,15 +7,23 @@
 # SPDX-License-Identifier: MPL-2.0
 #
 
-set(_dfl_cmd ${EXE} --network=res/TestIIDM_${TEST_NAME}.iidm --config=res/config_${TEST_NAME}.json --contingencies=res/contingencies_${TEST_NAME}.json)
+# the network and contingencies of another test may be used, in which case its reference results are expected
+if(NOT DEFINED INPUT_NAME OR INPUT_NAME STREQUAL "")
+  set(INPUT_NAME ${TEST_NAME})
+endif()
+if(NOT DEFINED MPI_NB_PROCS OR MPI_NB_PROCS STREQUAL "")
+  set(MPI_NB_PROCS 4)
+endif()
+
+set(_dfl_cmd ${EXE} --network=res/TestIIDM_${INPUT_NAME}.iidm --config=res/config_${TEST_NAME}.json --contingencies=res/contingencies_${INPUT_NAME}.json)
 if(NOT DEFINED USE_MPI OR USE_MPI STREQUAL "")
   message(FATAL_ERROR "USE_MPI is not defined")
 endif()
-if(${USE_MPI} STREQUAL "YES")
+if(${USE_MPI} STREQUAL "YES" AND MPI_NB_PROCS GREATER 1)
   if(NOT DEFINED MPI_RUN OR MPI_RUN STREQUAL "")
     message(FATAL_ERROR "mpirun is not found")
   endif()
-  set(_command ${MPI_RUN} -np 4 ${_dfl_cmd})
+  set(_command ${MPI_RUN} -np ${MPI_NB_PROCS} ${_dfl_cmd})
 else()
   set(_command ${_dfl_cmd})
 endif()
@@ -25,16 +33,16 @@ if(_result)
   message(FATAL_ERROR "Execution failed: ${_command}")
 endif()
 
-set(_command ${PYTHON_COMMAND} ${DIFF_SCRIPT} . ${TEST_NAME} res/config_${TEST_NAME}.json)
+set(_command ${PYTHON_COMMAND} ${DIFF_SCRIPT} . ${TEST_NAME} res/config_${TEST_NAME}.json --reference=${INPUT_NAME})
 if(DEFINED DIFF_SCRIPT)
   message(STATUS "Execute process: ${_command}")
   execute_process(COMMAND ${_command} RESULT_VARIABLE _result)
   if(_result)
-    message(FATAL_ERROR "resultsTestsTmp/${TEST_NAME} has some different files from reference/${TEST_NAME}")
+    message(FATAL_ERROR "resultsTestsTmp/${TEST_NAME} has some different files from reference/${INPUT_NAME}")
   endif()
 endif()
 
-set(_command ${PYTHON_COMMAND} ${CHECK_SCRIPT} . ${TEST_NAME} "TestIIDM_${TEST_NAME}")
+set(_command ${PYTHON_COMMAND} ${CHECK_SCRIPT} . ${TEST_NAME} "TestIIDM_${INPUT_NAME}" --contingencies=${INPUT_NAME})
 if(DEFINED CHECK_SCRIPT)
   message(STATUS "Execute process: ${_command}")
   execute_process(COMMAND ${_command} RESULT_VARIABLE _result)
@@ -14,9 +14,9 @@ contingency_event_time_nsa = 110
 timeline_log_regex = re.compile("^" + str(contingency_event_time) + "(\.0*)?\s\|\s([\w-]+)\s\|\s\w+\s[:\s]*[\w\s]+$|^" + str(contingency_event_time_nsa) + "(\.0*)?\s\|\s([\w-]+)\s\|\s\w+\s[:\s]*[\w\s]+$", re.MULTILINE)
 
 ### Code #######################################################################
-def check_test_contingencies(tests_path, test_name, input_iidm_name):
+def check_test_contingencies(tests_path, test_name, input_iidm_name, contingencies_name):
     results_folder = os.path.join(tests_path, 'resultsTestsTmp', test_name)
-    contingencies_file = os.path.join(tests_path, 'res/contingencies_' + test_name + '.json')
+    contingencies_file = os.path.join(tests_path, 'res/contingencies_' + contingencies_name + '.json')
 
     return check_contingencies(contingencies_file, results_folder, input_iidm_name)
 
@@ -201,6 +201,7 @@ def get_argparser():
     parser.add_argument("root", type=str, help="Root directory to process")
     parser.add_argument("test", type=str, help="Test name")
     parser.add_argument("iidm_name", type=str, help="IIDM input file")
+    parser.add_argument("--contingencies", type=str, help="Name of the contingencies input file, the test name by default")
 
     return parser
 
@@ -212,4 +213,5 @@ if __name__ == '__main__':
         print("[ERROR] environment variable DYNAFLOW_LAUNCHER_BUILD_TYPE needs to be defined")
         exit(1)
 
-    sys.exit(check_test_contingencies(options.root, options.test, options.iidm_name))
+    sys.exit(check_test_contingencies(options.root, options.test, options.iidm_name,
+                                      options.contingencies if options.contingencies else options.test))
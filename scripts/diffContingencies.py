@@ -34,6 +34,7 @@ def get_argparser():
     parser.add_argument("root", type=str, help="Root directory to process")
     parser.add_argument("testdir", type=str, help="Test directory to process")
     parser.add_argument("config", type=str, help="Simulation configuration file")
+    parser.add_argument("--reference", type=str, help="Reference directory to compare with, the test directory by default")
 
     return parser
 
@@ -51,7 +52,7 @@ def compare_file(options, contingency_folder, chosen_outputs):
             result_path = full_path(
                 options.root, "resultsTestsTmp", options.testdir, contingency_folder, "outputs", "finalState", "outputIIDM.xml")
             reference_path = full_path(
-                options.root, "reference", options.testdir, contingency_folder, "outputIIDM.xml")
+                options.root, "reference", options.reference, contingency_folder, "outputIIDM.xml")
 
             # A reference file that does not exist is only a problem if there's a result
             # file, there are cases where the file itself should not exist
@@ -76,7 +77,7 @@ def compare_file(options, contingency_folder, chosen_outputs):
         result_path = full_path(
             options.root, "resultsTestsTmp", options.testdir, "constraints", "constraints_" + contingency_folder + ".xml")
         reference_path = full_path(
-            options.root, "reference", options.testdir, contingency_folder, "constraints.xml")
+            options.root, "reference", options.reference, contingency_folder, "constraints.xml")
 
         if not os.path.exists(reference_path):
             if options.verbose:
@@ -99,7 +100,7 @@ def compare_file(options, contingency_folder, chosen_outputs):
         result_path = full_path(
             options.root, "resultsTestsTmp", options.testdir, "lostEquipments", "lostEquipments_" + contingency_folder + ".xml")
         reference_path = full_path(
-            options.root, "reference", options.testdir, contingency_folder, "lostEquipments.xml")
+            options.root, "reference", options.reference, contingency_folder, "lostEquipments.xml")
 
         if not os.path.exists(reference_path):
             if options.verbose:
@@ -129,6 +130,8 @@ def full_path(a, *paths):
 if __name__ == "__main__":
     parser = get_argparser()
     options = parser.parse_args()
+    if options.reference is None:
+        options.reference = options.testdir
     buildType = os.getenv("DYNAFLOW_LAUNCHER_BUILD_TYPE")
     total_diffs = 0
     config_root = full_path(options.root, options.config)
@@ -143,7 +146,7 @@ if __name__ == "__main__":
                 pass
 
     results_root = full_path(options.root, "resultsTestsTmp", options.testdir)
-    reference_root = full_path(options.root, "reference", options.testdir)
+    reference_root = full_path(options.root, "reference", options.reference)
 
     print(results_root)
     for folder in os.listdir(results_root):
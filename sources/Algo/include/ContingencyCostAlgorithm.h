@@ -0,0 +1,114 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ContingencyCostAlgorithm.h
+ *
+ * @brief Dynaflow launcher algorithm estimating the cost of the contingencies simulations header file
+ *
+ */
+
+#pragma once
+
+#include "AlgorithmsResults.h"
+#include "Contingencies.h"
+#include "Node.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace dfl {
+
+using NodePtr = std::shared_ptr<inputs::Node>;  ///< Alias for pointer to node
+
+namespace algo {
+
+/**
+ * @brief Estimation of the cost of the simulation of each contingency
+ *
+ * The cost is estimated from network features of the elements of the contingency: their number, the highest nominal voltage of their nodes,
+ * the distance of their nodes to the slack node and whether removing them splits the network. When durations measured by previous runs are
+ * available, they are used as is and the estimations of the other contingencies are scaled to the same unit.
+ */
+class ContingencyCosts {
+ public:
+  using ContingencyId = std::string;                                         ///< Alias for contingency identifier
+  using ElementId = std::string;                                             ///< Alias for element identifier
+  using Costs = std::unordered_map<ContingencyId, double>;                   ///< Alias for costs by contingency
+  using ElementNodes = std::unordered_map<ElementId, std::vector<NodePtr>>;  ///< Alias for nodes of the elements
+
+  /**
+   * @brief Estimate the cost of the contingencies
+   *
+   * @param contingencies the contingencies to simulate
+   * @param slackNode the slack node of the network
+   * @param history the durations measured by previous runs, by contingency
+   * @returns the estimated cost of each contingency
+   */
+  Costs estimate(const std::vector<inputs::Contingency> &contingencies, const NodePtr &slackNode, const Costs &history) const;
+
+  /**
+   * @brief Sort the contingencies so that the most expensive ones come first
+   *
+   * Contingencies with the same cost keep their input order
+   *
+   * @param contingencies the contingencies to sort
+   * @param costs the cost of each contingency
+   * @returns the indexes of the contingencies, from the most expensive to the cheapest
+   */
+  static std::vector<std::size_t> longestFirst(const std::vector<inputs::Contingency> &contingencies, const Costs &costs);
+
+  ElementNodes elementNodes;   ///< nodes connected to each element of the main connex component
+  std::vector<NodePtr> nodes;  ///< nodes of the main connex component
+
+ private:
+  /**
+   * @brief Computes the distance of the nodes to a node, in number of branches
+   *
+   * @param origin the node from which distances are computed
+   * @returns the distance by node
+   */
+  std::unordered_map<const inputs::Node *, unsigned int> distances(const NodePtr &origin) const;
+
+  /**
+   * @brief Computes the pairs of nodes linked by a bridge, which splits the network when it is removed
+   *
+   * @returns the pairs of nodes linked by a bridge, smallest node address first
+   */
+  std::vector<std::pair<const inputs::Node *, const inputs::Node *>> bridges() const;
+};
+
+/**
+ * @brief Algorithm collecting the network features used to estimate the cost of the contingencies
+ */
+class ContingencyCostAlgorithm {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param costs the contingency costs to update
+   */
+  explicit ContingencyCostAlgorithm(ContingencyCosts &costs) : costs_(costs) {}
+
+  /**
+   * @brief Perform the algorithm
+   *
+   * @param node the node to process
+   * @param algoRes pointer to algorithms results class
+   */
+  void operator()(const NodePtr &node, std::shared_ptr<AlgorithmsResults> &algoRes);
+
+ private:
+  ContingencyCosts &costs_;  ///< the contingency costs to update
+};
+
+}  // namespace algo
+}  // namespace dfl
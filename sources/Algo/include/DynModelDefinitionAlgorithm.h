@@ -19,10 +19,12 @@
 
 #include "AlgorithmsResults.h"
 #include "DynamicDataBaseManager.h"
+#include "LibraryProbeCache.h"
 #include "NetworkManager.h"
 #include "Node.h"
 
 #include <array>
+#include <boost/container/flat_set.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/optional.hpp>
 #include <functional>
@@ -123,6 +125,9 @@ struct DynamicModelDefinition {
     std::string indexId;           ///< Id used to index the macroConnections
   };
 
+  /// @brief Macro connections of a dynamic model, stored as a sorted vector: they are inserted once and then read several times by the writers
+  using MacroConnections = boost::container::flat_set<MacroConnection>;
+
   /**
    * @brief Constructor
    *
@@ -133,7 +138,7 @@ struct DynamicModelDefinition {
 
   DynModelId id;                              ///< dynamic model id
   std::string lib;                            ///< library name
-  std::set<MacroConnection> nodeConnections;  ///< set of macro connections for the dynamic model
+  MacroConnections nodeConnections;  ///< set of macro connections for the dynamic model
 };
 
 /**
@@ -157,8 +162,10 @@ class DynModelAlgorithm {
    * @param models the models to update
    * @param manager the dynamic data base manager to use
    * @param shuntRegulationOn whether the shunt regulation is activated or not
+   * @param libraryProbeCache the cache of the library probes to use and update while constructing, nullptr to load every automaton library
    */
-  DynModelAlgorithm(DynamicModelDefinitions &models, const inputs::DynamicDataBaseManager &manager, bool shuntRegulationOn);
+  DynModelAlgorithm(DynamicModelDefinitions &models, const inputs::DynamicDataBaseManager &manager, bool shuntRegulationOn,
+                    LibraryProbeCache *libraryProbeCache = nullptr);
 
   /**
    * @brief Perform the algorithm
@@ -171,6 +178,14 @@ class DynModelAlgorithm {
    */
   void operator()(const NodePtr &node, std::shared_ptr<AlgorithmsResults> &algoRes);
 
+  /**
+   * @brief Store the macro connections collected while processing the nodes in the models definitions
+   *
+   * The connections are sorted once for each model instead of being inserted one by one in the sorted storage.
+   * Must be called once all the nodes are processed.
+   */
+  void storeMacroConnections();
+
  private:
   /**
    * @brief DynModel macro connect definition
@@ -222,10 +237,14 @@ class DynModelAlgorithm {
  private:
   /**
    * @brief Determines if a library is loadable in current environement
+   *
+   * The library is not loaded if the cache of the library probes knows it is loadable
+   *
    * @param lib library name
+   * @param libraryProbeCache the cache of the library probes to use and update, nullptr to load the library
    * @returns true if library could be loaded, false if not
    */
-  static bool libraryExists(const std::string &lib);
+  static bool libraryExists(const std::string &lib, LibraryProbeCache *libraryProbeCache);
 
   /**
    * @brief Computes library path for library name
@@ -240,7 +259,8 @@ class DynModelAlgorithm {
  private:
   /// @brief Extract models from configuration before processing the nodes
   /// @param shuntRegulationOn whether the shunt regulation is activated or not
-  void extractDynModels(bool shuntRegulationOn);
+  /// @param libraryProbeCache the cache of the library probes to use and update, nullptr to load every automaton library
+  void extractDynModels(bool shuntRegulationOn, LibraryProbeCache *libraryProbeCache);
 
   /**
    * @brief Process single association from configuration
@@ -320,7 +340,7 @@ class DynModelAlgorithm {
    * @brief Add macro connection to the dynamic model definition
    *
    * Creates the dynamic model definition if not already existing
-   * Update the dynamic model definitions member
+   * Collect the macro connection, stored in the dynamic model definition by @a storeMacroConnections
    *
    * @param automaton the dynamic automaton
    * @param macroConnection the macro connection to add
@@ -330,6 +350,8 @@ class DynModelAlgorithm {
 
  private:
   DynamicModelDefinitions &dynamicModels_;  ///< Dynamic model definitions to update
+  std::unordered_map<DynamicModelDefinition::DynModelId, std::vector<DynamicModelDefinition::MacroConnection>>
+      collectedConnections_;  ///< macro connections not yet stored in the dynamic model definitions, by dynamic model id
 
   std::unordered_map<inputs::VoltageLevel::VoltageLevelId, std::unordered_set<MacroConnect, MacroConnectHash>>
       macroConnectByVlForBusesId_;  ///< macro connections for buses, by voltage level
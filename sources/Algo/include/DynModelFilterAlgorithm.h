@@ -21,6 +21,8 @@
 #include "DynModelDefinitionAlgorithm.h"
 #include "GeneratorDefinitionAlgorithm.h"
 
+#include <unordered_map>
+
 namespace dfl {
 namespace algo {
 
@@ -71,9 +73,19 @@ class DynModelFilterAlgorithm {
    */
   void filterPartiallyConnectedDynamicModels();
 
+  /**
+   * @brief Find a generator of the generators list by its id
+   *
+   * @param generatorId the generator id
+   *
+   * @returns the generator with this id, nullptr if not found
+   */
+  GeneratorDefinition* findGenerator(const std::string& generatorId) const;
+
   const inputs::AssemblingDataBase& assembling_;                                         ///< assembling database
   GeneratorDefinitionAlgorithm::Generators& generators_;                                 ///< the generators list to update
   std::map<DynamicModelDefinition::DynModelId, DynamicModelDefinition>& dynamicModelsToFilter_;  ///< models by dynamic model id
+  std::unordered_map<std::string, GeneratorDefinition*> generatorsById_;                 ///< generators of the generators list by id
 };
 
 }  // namespace algo
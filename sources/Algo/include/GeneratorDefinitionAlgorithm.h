@@ -22,6 +22,8 @@
 #include "NetworkManager.h"
 #include "Node.h"
 
+#include <algorithm>
+
 namespace dfl {
 
 using NodePtr = std::shared_ptr<inputs::Node>;  ///< Alias for pointer to node
@@ -165,12 +167,16 @@ class GeneratorDefinition {
    * @param targetP target active power of the generator
    * @param regulatedBusId the Bus Id this generator is regulating
    * @param isNuclear true if the energy source of this generator is nuclear
+   *
+   * The curve points are sorted by active power once here so that writers can use them as is
    */
   GeneratorDefinition(const inputs::Generator::GeneratorId &genId, ModelType type, const inputs::Node::NodeId &nodeId,
                       const std::vector<ReactiveCurvePoint> &curvePoints, double qmin, double qmax, double pmin, double pmax, double q, double targetP,
                       const BusId &regulatedBusId, bool isNuclear = false)
       : id{genId}, model{type}, nodeId{nodeId},
-        points(curvePoints), qmin{qmin}, qmax{qmax}, pmin{pmin}, pmax{pmax}, q{q}, targetP{targetP}, regulatedBusId{regulatedBusId}, isNuclear{isNuclear} {}
+        points(curvePoints), qmin{qmin}, qmax{qmax}, pmin{pmin}, pmax{pmax}, q{q}, targetP{targetP}, regulatedBusId{regulatedBusId}, isNuclear{isNuclear} {
+    std::sort(points.begin(), points.end(), [](const ReactiveCurvePoint &lhs, const ReactiveCurvePoint &rhs) { return lhs.p < rhs.p; });
+  }
 
   inputs::Generator::GeneratorId id;       ///< generator id
   ModelType model;                         ///< model
@@ -249,9 +255,8 @@ class GeneratorDefinitionAlgorithm {
 
   Generators &generators_;                                                        ///< the generators list to update
   const inputs::NetworkManager::BusMapRegulating &busesToNumberOfRegulationMap_;  ///< mapping of busId and the number of generators that regulates them
-  std::unordered_map<std::string, bool> generatorsInSVC;  ///< If a generator id is in this map then it belongs to a secondary voltage control area,
-                                                          // if the associated bool is true then it uses a reactive power control loop 2
-  bool useInfiniteReactivelimits_;                        ///< determine if infinite reactive limits are used,
+  const inputs::AssemblingDataBase &assembling_;  ///< assembling database, telling which generators belong to a secondary voltage control area
+  bool useInfiniteReactivelimits_;                ///< determine if infinite reactive limits are used,
   double tfoVoltageLevel_;  ///< Maximum voltage level for which we assume that generator's transformers are already described in the static description
 };
 }  // namespace algo
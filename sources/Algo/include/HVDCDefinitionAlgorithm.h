@@ -24,6 +24,7 @@
 #include "Node.h"
 
 #include <DYNCommon.h>
+#include <algorithm>
 
 namespace dfl {
 
@@ -44,9 +45,13 @@ class VSCDefinition {
    * @param q the reactive power value of the converter
    * @param pMax the maximum active power capability value of the converter
    * @param points the reactive curve points of the converter, if any
+   *
+   * The curve points are sorted by active power once here so that writers can use them as is
    */
   VSCDefinition(const VSCId &id, double qMax, double qMin, double q, double pMax, const std::vector<ReactiveCurvePoint> &points)
-      : id(id), qmax{qMax}, qmin{qMin}, q(q), pmax(pMax), pmin(-pMax), points(points) {}
+      : id(id), qmax{qMax}, qmin{qMin}, q(q), pmax(pMax), pmin(-pMax), points(points) {
+    std::sort(this->points.begin(), this->points.end(), [](const ReactiveCurvePoint &lhs, const ReactiveCurvePoint &rhs) { return lhs.p < rhs.p; });
+  }
 
   /**
    * @brief Equality operator for VSCDefinition
@@ -347,13 +352,19 @@ class HVDCDefinitionAlgorithm {
    */
   std::pair<std::reference_wrapper<HVDCDefinition>, bool> getOrCreateHvdcLineDefinition(const inputs::HvdcLine &hvdcLine);
 
+  /**
+   * @brief Retrieve the side of the HVDC line defined by the secondary voltage control area it belongs to
+   * @param hvdcLineId the HVDC line id
+   * @returns the side on which the side 1 of the HVDC line should be connected, nothing if the HVDC line does not belong to a secondary voltage control area
+   */
+  boost::optional<inputs::AssemblingDataBase::HvdcLineConverterSide> getSVCConverterSide(const std::string &hvdcLineId) const;
+
  private:
   HVDCLineDefinitions &hvdcLinesDefinitions_;                                     ///< The HVDC lines definitions to update
   const inputs::NetworkManager::BusMapRegulating &busesToNumberOfRegulationMap_;  ///< mapping of busId and the number of generators that regulates them
   const bool infiniteReactiveLimits_;                                             ///< whether we use infinite reactive limits
   std::unordered_map<inputs::Converter::ConverterId, std::shared_ptr<inputs::Converter>> vscConverters_;  ///< List of VSC converters to use
-  std::unordered_map<std::string, inputs::AssemblingDataBase::HvdcLineConverterSide>
-      hvdcLinesInSVC_;  ///< If a hvdc line id is in this map then it belongs to a secondary voltage control area
+  const inputs::AssemblingDataBase &assembling_;  ///< assembling database, telling which hvdc lines belong to a secondary voltage control area
 };
 
 }  // namespace algo
@@ -0,0 +1,99 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  LibraryProbeCache.h
+ *
+ * @brief Dynaflow launcher cache of the shared library probes header file
+ *
+ */
+
+#pragma once
+
+#include <boost/filesystem.hpp>
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <unordered_map>
+
+namespace dfl {
+namespace algo {
+
+/**
+ * @brief Cache of the shared libraries successfully loaded by a previous probe, shared by successive runs and by concurrent processes
+ *
+ * Each entry records the path, the size and the modification date of a library. A library whose size and modification date did not
+ * change since it was recorded is considered loadable as long as its ELF header matches the current process, so that it is not loaded
+ * again. Libraries which failed to load are not recorded, so that they are probed again on the next run.
+ */
+class LibraryProbeCache {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param filepath the file of the cache, read if it exists
+   */
+  explicit LibraryProbeCache(const boost::filesystem::path &filepath);
+
+  /**
+   * @brief Determines whether a library is known to be loadable
+   *
+   * @param library the path of the library
+   * @returns true if the library is recorded with its current size and modification date and its header is valid, false if it must be loaded
+   */
+  bool contains(const boost::filesystem::path &library) const;
+
+  /**
+   * @brief Records a library successfully loaded
+   *
+   * @param library the path of the library
+   */
+  void add(const boost::filesystem::path &library);
+
+  /**
+   * @brief Export the cache, merged with the entries written by concurrent processes since it was read
+   *
+   * The file is written under a temporary name renamed once complete, so that a partial file is never read
+   */
+  void write() const;
+
+  /**
+   * @brief Determines whether the header of a file describes a shared library loadable by the current process
+   *
+   * @param library the path of the library
+   * @returns true if the file is an ELF shared object of the class, byte order and machine of the current process. Always false on
+   * platforms not using ELF, so that the library is loaded
+   */
+  static bool isLoadableHeader(const boost::filesystem::path &library);
+
+ private:
+  /// @brief Cache entry for a library
+  struct Entry {
+    uintmax_t size;             ///< size of the library in bytes
+    std::time_t lastWriteTime;  ///< modification date of the library
+  };
+
+  /**
+   * @brief Read the entries of a cache file
+   *
+   * Malformed lines are ignored
+   *
+   * @param filepath the file of the cache
+   * @param entries the entries to update, by library path
+   */
+  static void read(const boost::filesystem::path &filepath, std::unordered_map<std::string, Entry> &entries);
+
+  boost::filesystem::path filepath_;                ///< file of the cache
+  std::unordered_map<std::string, Entry> entries_;  ///< entries of the cache, by library path
+  bool modified_ = false;                           ///< whether entries were added since the file was read
+};
+
+}  // namespace algo
+}  // namespace dfl
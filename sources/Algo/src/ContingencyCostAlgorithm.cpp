@@ -0,0 +1,220 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ContingencyCostAlgorithm.cpp
+ *
+ * @brief Dynaflow launcher algorithm estimating the cost of the contingencies simulations implementation file
+ *
+ */
+
+#include "ContingencyCostAlgorithm.h"
+
+#include "HvdcLine.h"
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <numeric>
+#include <set>
+
+namespace dfl {
+namespace algo {
+
+namespace helper {
+
+/// @brief Nominal voltage, in kV, for which the voltage factor of the cost doubles
+static constexpr double referenceVoltage = 400.;
+
+/// @brief Factor of the cost of a contingency splitting the network
+static constexpr double islandingFactor = 2.;
+
+}  // namespace helper
+
+void ContingencyCostAlgorithm::operator()(const NodePtr &node, std::shared_ptr<AlgorithmsResults> &) {
+  costs_.nodes.push_back(node);
+  auto addElement = [this, &node](const ContingencyCosts::ElementId &id) { costs_.elementNodes[id].push_back(node); };
+
+  for (const auto &line : node->lines) {
+    addElement(line.lock()->id);
+  }
+  for (const auto &tfo : node->tfos) {
+    addElement(tfo.lock()->id);
+  }
+  for (const auto &converter : node->converters) {
+    addElement(converter.lock()->hvdcLine->id);
+  }
+  for (const auto &shunt : node->shunts) {
+    addElement(shunt.id);
+  }
+  for (const auto &danglingLine : node->danglingLines) {
+    addElement(danglingLine.id);
+  }
+  for (const auto &busBarSection : node->busBarSections) {
+    addElement(busBarSection.id);
+  }
+  for (const auto &load : node->loads) {
+    addElement(load.id);
+  }
+  for (const auto &generator : node->generators) {
+    addElement(generator.id);
+  }
+  for (const auto &svarc : node->svarcs) {
+    addElement(svarc.id);
+  }
+}
+
+std::unordered_map<const inputs::Node *, unsigned int> ContingencyCosts::distances(const NodePtr &origin) const {
+  std::unordered_map<const inputs::Node *, unsigned int> result;
+  if (!origin) {
+    return result;
+  }
+  std::deque<const inputs::Node *> queue{origin.get()};
+  result[origin.get()] = 0;
+  while (!queue.empty()) {
+    const inputs::Node *node = queue.front();
+    queue.pop_front();
+    unsigned int distance = result[node] + 1;
+    for (const auto &neighbour : node->neighbours) {
+      if (result.emplace(neighbour.get(), distance).second) {
+        queue.push_back(neighbour.get());
+      }
+    }
+  }
+  return result;
+}
+
+std::vector<std::pair<const inputs::Node *, const inputs::Node *>> ContingencyCosts::bridges() const {
+  // Iterative Tarjan bridge search, so that the depth of the network does not matter
+  // Parallel branches appear several times in the neighbours: only the first occurrence of the parent is skipped, so they are not bridges
+  struct Frame {
+    const inputs::Node *node;    ///< visited node
+    const inputs::Node *parent;  ///< node from which the node was reached
+    bool parentSkipped;          ///< whether the branch to the parent was already skipped
+    std::size_t next;            ///< index of the next neighbour to visit
+  };
+
+  std::vector<std::pair<const inputs::Node *, const inputs::Node *>> result;
+  std::unordered_map<const inputs::Node *, unsigned int> discovery;
+  std::unordered_map<const inputs::Node *, unsigned int> low;
+  unsigned int time = 0;
+  for (const auto &start : nodes) {
+    if (discovery.count(start.get()) > 0) {
+      continue;
+    }
+    discovery[start.get()] = low[start.get()] = ++time;
+    std::vector<Frame> stack{Frame{start.get(), nullptr, false, 0}};
+    while (!stack.empty()) {
+      Frame &frame = stack.back();
+      const inputs::Node *node = frame.node;
+      if (frame.next < node->neighbours.size()) {
+        const inputs::Node *neighbour = node->neighbours[frame.next++].get();
+        if (neighbour == frame.parent && !frame.parentSkipped) {
+          frame.parentSkipped = true;
+          continue;
+        }
+        auto found = discovery.find(neighbour);
+        if (found == discovery.end()) {
+          discovery[neighbour] = low[neighbour] = ++time;
+          stack.push_back(Frame{neighbour, node, false, 0});
+        } else {
+          low[node] = std::min(low[node], found->second);
+        }
+      } else {
+        const inputs::Node *parent = frame.parent;
+        stack.pop_back();
+        if (parent) {
+          low[parent] = std::min(low[parent], low[node]);
+          if (low[node] > discovery[parent]) {
+            result.push_back(std::minmax(parent, node));
+          }
+        }
+      }
+    }
+  }
+  return result;
+}
+
+ContingencyCosts::Costs ContingencyCosts::estimate(const std::vector<inputs::Contingency> &contingencies, const NodePtr &slackNode,
+                                                   const Costs &history) const {
+  const auto &distancesToSlack = distances(slackNode);
+  const auto &bridgesList = bridges();
+  const std::set<std::pair<const inputs::Node *, const inputs::Node *>> bridgesSet(bridgesList.begin(), bridgesList.end());
+
+  Costs estimations;
+  double historyTotal = 0.;
+  double estimationsTotal = 0.;
+  for (const auto &contingency : contingencies) {
+    double maxVoltage = 0.;
+    unsigned int minDistance = std::numeric_limits<unsigned int>::max();
+    bool islanding = false;
+    for (const auto &element : contingency.elements) {
+      auto found = elementNodes.find(element.id);
+      if (found == elementNodes.end()) {
+        continue;
+      }
+      const auto &nodesElement = found->second;
+      for (const auto &node : nodesElement) {
+        maxVoltage = std::max(maxVoltage, node->nominalVoltage);
+        auto distance = distancesToSlack.find(node.get());
+        if (distance != distancesToSlack.end()) {
+          minDistance = std::min(minDistance, distance->second);
+        }
+      }
+      if (element.type == inputs::ContingencyElement::Type::BUSBAR_SECTION) {
+        // all the branches of the bus bar section are disconnected
+        islanding = true;
+      }
+      for (std::size_t i = 0; i < nodesElement.size() && !islanding; ++i) {
+        for (std::size_t j = i + 1; j < nodesElement.size() && !islanding; ++j) {
+          islanding = bridgesSet.count(std::minmax(nodesElement[i].get(), nodesElement[j].get())) > 0;
+        }
+      }
+    }
+
+    double cost = static_cast<double>(contingency.elements.size()) * (1. + maxVoltage / helper::referenceVoltage);
+    if (minDistance != std::numeric_limits<unsigned int>::max()) {
+      // the closer to the slack node, the larger the disturbance of the whole network
+      cost *= 1. + 1. / (1. + minDistance);
+    }
+    if (islanding) {
+      cost *= helper::islandingFactor;
+    }
+    estimations[contingency.id] = cost;
+
+    auto measured = history.find(contingency.id);
+    if (measured != history.end()) {
+      historyTotal += measured->second;
+      estimationsTotal += cost;
+    }
+  }
+
+  // Estimations are scaled so that they can be compared to the measured durations
+  const double scale = (estimationsTotal > 0.) ? historyTotal / estimationsTotal : 1.;
+  for (auto &estimation : estimations) {
+    auto measured = history.find(estimation.first);
+    estimation.second = (measured != history.end()) ? measured->second : estimation.second * scale;
+  }
+  return estimations;
+}
+
+std::vector<std::size_t> ContingencyCosts::longestFirst(const std::vector<inputs::Contingency> &contingencies, const Costs &costs) {
+  std::vector<std::size_t> order(contingencies.size());
+  std::iota(order.begin(), order.end(), 0);
+  auto cost = [&contingencies, &costs](std::size_t index) {
+    auto found = costs.find(contingencies[index].id);
+    return (found != costs.end()) ? found->second : 0.;
+  };
+  std::stable_sort(order.begin(), order.end(), [&cost](std::size_t lhs, std::size_t rhs) { return cost(lhs) > cost(rhs); });
+  return order;
+}
+
+}  // namespace algo
+}  // namespace dfl
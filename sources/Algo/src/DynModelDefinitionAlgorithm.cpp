@@ -15,6 +15,7 @@
 #include <DYNCommon.h>
 #include <DYNExecUtils.h>
 #include <DYNTimer.h>
+#include <algorithm>
 #include <boost/dll/import.hpp>
 #include <boost/functional.hpp>
 #include <tuple>
@@ -22,9 +23,10 @@
 namespace dfl {
 namespace algo {
 
-DynModelAlgorithm::DynModelAlgorithm(DynamicModelDefinitions &models, const inputs::DynamicDataBaseManager &manager, bool shuntRegulationOn)
+DynModelAlgorithm::DynModelAlgorithm(DynamicModelDefinitions &models, const inputs::DynamicDataBaseManager &manager, bool shuntRegulationOn,
+                                     LibraryProbeCache *libraryProbeCache)
     : dynamicModels_(models), manager_(manager) {
-  extractDynModels(shuntRegulationOn);
+  extractDynModels(shuntRegulationOn, libraryProbeCache);
 }
 
 boost::optional<boost::filesystem::path> DynModelAlgorithm::findLibraryPath(const std::string &lib) {
@@ -50,15 +52,21 @@ boost::optional<boost::filesystem::path> DynModelAlgorithm::findLibraryPath(cons
   return boost::make_optional(libPathDfl);
 }
 
-bool DynModelAlgorithm::libraryExists(const std::string &lib) {
+bool DynModelAlgorithm::libraryExists(const std::string &lib, LibraryProbeCache *libraryProbeCache) {
   try {
     // check DFL local path
     auto libPath = findLibraryPath(lib);
     if (!libPath) {
       return false;
     }
+    if (libraryProbeCache && libraryProbeCache->contains(*libPath)) {
+      return true;
+    }
     boost::dll::shared_library sharedLib(libPath->generic_string());
     static_cast<void>(sharedLib);  // do nothing as we just want to check that the library can be loaded
+    if (libraryProbeCache) {
+      libraryProbeCache->add(*libPath);
+    }
     return true;
   } catch (const std::exception &e) {
     LOG(warn, CannotLoadLibrary, lib, e.what());
@@ -99,10 +107,10 @@ void DynModelAlgorithm::extractSingleAssociationInfo(const inputs::AssemblingDat
   }
 }
 
-void DynModelAlgorithm::extractDynModels(bool shuntRegulationOn) {
+void DynModelAlgorithm::extractDynModels(bool shuntRegulationOn, LibraryProbeCache *libraryProbeCache) {
   for (const auto &automaton : manager_.assembling().dynamicAutomatons()) {
     // Check that the automaton library is available
-    if (!libraryExists(automaton.second.lib)) {
+    if (!libraryExists(automaton.second.lib, libraryProbeCache)) {
       LOG(warn, DynModelLibraryNotFound, automaton.second.lib, automaton.first);
       continue;
     }
@@ -134,8 +142,8 @@ bool DynamicModelDefinition::MacroConnection::operator==(const MacroConnection &
 bool DynamicModelDefinition::MacroConnection::operator!=(const MacroConnection &other) const { return !((*this) == other); }
 
 bool DynamicModelDefinition::MacroConnection::operator<(const MacroConnection &other) const {
-  return (id + std::to_string(static_cast<unsigned int>(elementType)) + connectedElementId) <
-         (other.id + std::to_string(static_cast<unsigned int>(other.elementType)) + other.connectedElementId);
+  // lexicographic comparison of the same fields as the equality, without building any temporary string
+  return std::tie(id, elementType, connectedElementId) < std::tie(other.id, other.elementType, other.connectedElementId);
 }
 
 bool DynamicModelDefinition::MacroConnection::operator<=(const MacroConnection &other) const { return (*this) < other || (*this) == other; }
@@ -275,14 +283,19 @@ void DynModelAlgorithm::connectMacroConnectionForHvdc(const inputs::HvdcLine &hv
 void DynModelAlgorithm::addMacroConnectionToModelDefinitions(const dfl::inputs::AssemblingDataBase::DynamicAutomaton &automaton,
                                                              const DynamicModelDefinition::MacroConnection &macroConnection) {
   if (dynamicModels_.models.count(automaton.id) == 0) {
-    DynamicModelDefinition modelDef(automaton.id, automaton.lib);
-    modelDef.nodeConnections.insert(macroConnection);
+    dynamicModels_.models.insert({automaton.id, DynamicModelDefinition(automaton.id, automaton.lib)});
+  }
+  collectedConnections_[automaton.id].push_back(macroConnection);
+}
 
-    dynamicModels_.models.insert({automaton.id, modelDef});
-  } else {
-    auto &modelDef = dynamicModels_.models.at(automaton.id);
-    modelDef.nodeConnections.insert(macroConnection);
+void DynModelAlgorithm::storeMacroConnections() {
+  for (auto &collected : collectedConnections_) {
+    auto &connections = collected.second;
+    std::sort(connections.begin(), connections.end());
+    connections.erase(std::unique(connections.begin(), connections.end()), connections.end());
+    dynamicModels_.models.at(collected.first).nodeConnections.insert(boost::container::ordered_unique_range, connections.begin(), connections.end());
   }
+  collectedConnections_.clear();
 }
 
 void DynModelAlgorithm::operator()(const NodePtr &node, std::shared_ptr<AlgorithmsResults> &) {
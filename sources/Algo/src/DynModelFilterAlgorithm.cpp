@@ -12,11 +12,40 @@
 #include "Constants.h"
 #include "Log.h"
 
+#include <unordered_set>
+
 namespace dfl {
 namespace algo {
 
+namespace helper {
+
+/**
+ * @brief Retrieve the ids of the macro connections of a dynamic model
+ *
+ * @param dynamicModel the dynamic model
+ *
+ * @returns the set of the macro connection ids of the dynamic model
+ */
+static std::unordered_set<std::string>
+macroConnectionIds(const DynamicModelDefinition& dynamicModel) {
+  std::unordered_set<std::string> ids;
+  ids.reserve(dynamicModel.nodeConnections.size());
+  for (const DynamicModelDefinition::MacroConnection& nodeConnection : dynamicModel.nodeConnections) {
+    ids.insert(nodeConnection.id);
+  }
+  return ids;
+}
+
+}  // namespace helper
+
 void
 DynModelFilterAlgorithm::filter() {
+  // the generators list is not resized while filtering, so that the index remains valid
+  generatorsById_.clear();
+  generatorsById_.reserve(generators_.size());
+  for (GeneratorDefinition& generator : generators_) {
+    generatorsById_.emplace(generator.id, &generator);
+  }
   removeRpclInGeneratorsAndSvcIfMissingConnexionToSvc();
   filterPartiallyConnectedDynamicModels();
 }
@@ -30,12 +59,8 @@ DynModelFilterAlgorithm::removeRpclInGeneratorsAndSvcIfMissingConnexionToSvc() {
       if (!isSVCconnectedToUMeasurement) {
         svcToRemove.push_back(dynamicModel.second.id);
         for (const DynamicModelDefinition::MacroConnection& generatorConnectedToSVC : dynamicModel.second.nodeConnections) {
-          const DynamicModelDefinition::MacroConnection::ElementId& genId = generatorConnectedToSVC.connectedElementId;
-          auto foundGen = std::find_if(generators_.begin(), generators_.end(),
-                                        [&genId](const algo::GeneratorDefinition& genDefinition) {
-                                          return genDefinition.id == genId;
-                                        });
-          if (foundGen != generators_.end()) {
+          GeneratorDefinition* foundGen = findGenerator(generatorConnectedToSVC.connectedElementId);
+          if (foundGen) {
             foundGen->removeRpclFromModel();
           }
         }
@@ -55,17 +80,18 @@ DynModelFilterAlgorithm::checkIfSVCconnectedToUMeasurement(const algo::DynamicMo
   auto assemblingAutomatonIt = assemblingAutomatons.find(svcModel.id);
   assert(assemblingAutomatonIt != assemblingAutomatons.end());
   const std::vector<inputs::AssemblingDataBase::MacroConnect>& macroConnects = assemblingAutomatonIt->second.macroConnects;
-  for (inputs::AssemblingDataBase::MacroConnect macroConnect : macroConnects) {
-    const inputs::AssemblingDataBase::SingleAssociation& singleAssociation = assembling_.getSingleAssociation(macroConnect.id);
-    if (singleAssociation.bus.is_initialized()) {
-      auto macroConnectIt = std::find_if(svcModel.nodeConnections.begin(), svcModel.nodeConnections.end(),
-                                          [&macroConnect](const DynamicModelDefinition::MacroConnection& nodeConnection) {
-                                            return nodeConnection.id == macroConnect.macroConnection;
-                                          });
-      if (macroConnectIt != svcModel.nodeConnections.end()) {
-        isSVCconnectedToUMeasurement = true;
-        break;
-      }
+  // the single associations are resolved in the order of the macro connects
+  const std::vector<const inputs::AssemblingDataBase::SingleAssociation*>& singleAssociations = assembling_.getSingleAssociations(svcModel.id);
+  const std::unordered_set<std::string> nodeConnectionIds = helper::macroConnectionIds(svcModel);
+  for (std::size_t i = 0; i < macroConnects.size(); ++i) {
+    const inputs::AssemblingDataBase::MacroConnect& macroConnect = macroConnects[i];
+    const inputs::AssemblingDataBase::SingleAssociation* singleAssociation = singleAssociations[i];
+    if (singleAssociation == nullptr) {
+      throw Error(UnknownSingleAssoc, macroConnect.id);
+    }
+    if (singleAssociation->bus.is_initialized() && nodeConnectionIds.count(macroConnect.macroConnection) > 0) {
+      isSVCconnectedToUMeasurement = true;
+      break;
     }
   }
   return isSVCconnectedToUMeasurement;
@@ -85,13 +111,11 @@ DynModelFilterAlgorithm::filterPartiallyConnectedDynamicModels() {
     if (automaton.second.lib == dfl::common::constants::svcModelName) {
       std::vector<algo::DynamicModelDefinition::MacroConnection> toRemove;
       for (const DynamicModelDefinition::MacroConnection& connection : modelDef.nodeConnections) {
-        DynamicModelDefinition::MacroConnection::ElementId compId = connection.connectedElementId;
-        auto found = std::find_if(generators_.begin(), generators_.end(),
-                                  [&compId](const algo::GeneratorDefinition& genDefinition) { return genDefinition.id == compId; });
-        if (found != generators_.end() && found->isNetwork()) {
+        const GeneratorDefinition* found = findGenerator(connection.connectedElementId);
+        if (found && found->isNetwork()) {
           LOG(debug, SVCConnectedToDefaultGen, connection.connectedElementId, automaton.second.id);
           toRemove.push_back(connection);
-        } else if (found != generators_.end() && !found->hasRpcl()) {
+        } else if (found && !found->hasRpcl()) {
           LOG(debug, SVCConnectedToGenRegulatingNode, connection.connectedElementId, automaton.second.id);
           toRemove.push_back(connection);
         }
@@ -109,14 +133,10 @@ DynModelFilterAlgorithm::filterPartiallyConnectedDynamicModels() {
     if (dynamicModelsToFilter_.find(automaton.second.id) == dynamicModelsToFilter_.end())
       continue;
 
+    const std::unordered_set<std::string> nodeConnectionIds = helper::macroConnectionIds(modelDef);
     for (const inputs::AssemblingDataBase::MacroConnect& macroConnect : automaton.second.macroConnects) {
       if (macroConnect.mandatory) {
-        auto found = std::find_if(
-          modelDef.nodeConnections.begin(), modelDef.nodeConnections.end(),
-          [&macroConnect](const algo::DynamicModelDefinition::MacroConnection &macroConnection) {
-            return macroConnection.id == macroConnect.macroConnection;
-          });
-        if (found == modelDef.nodeConnections.end()) {
+        if (nodeConnectionIds.count(macroConnect.macroConnection) == 0) {
           LOG(debug, ModelPartiallyConnected, automaton.second.id);
           dynamicModelsToFilter_.erase(automaton.second.id);
           break;  // element doesn't exist any more, go to next automaton
@@ -126,5 +146,14 @@ DynModelFilterAlgorithm::filterPartiallyConnectedDynamicModels() {
   }
 }
 
+GeneratorDefinition*
+DynModelFilterAlgorithm::findGenerator(const std::string& generatorId) const {
+  auto it = generatorsById_.find(generatorId);
+  if (it == generatorsById_.end()) {
+    return nullptr;
+  }
+  return it->second;
+}
+
 }  // namespace algo
 }  // namespace dfl
@@ -52,30 +52,8 @@ void GeneratorDefinition::removeRpclFromModel() {
 
 GeneratorDefinitionAlgorithm::GeneratorDefinitionAlgorithm(Generators &gens, const inputs::NetworkManager::BusMapRegulating &busesToNumberOfRegulationMap,
                                                            const inputs::DynamicDataBaseManager &manager, bool infinitereactivelimits, double tfoVoltageLevel)
-    : generators_(gens), busesToNumberOfRegulationMap_(busesToNumberOfRegulationMap), useInfiniteReactivelimits_{infinitereactivelimits},
-      tfoVoltageLevel_(tfoVoltageLevel) {
-  for (const auto &automaton : manager.assembling().dynamicAutomatons()) {
-    if (automaton.second.lib == dfl::common::constants::svcModelName) {
-      for (const auto &macroConn : automaton.second.macroConnects) {
-        if (manager.assembling().isSingleAssociation(macroConn.id)) {
-          const auto &assoc = manager.assembling().getSingleAssociation(macroConn.id);
-          for (const auto &generator : assoc.generators) {
-            generatorsInSVC[generator.name] = false;
-          }
-        }
-      }
-    }
-  }
-  if (manager.assembling().isProperty(common::constants::rpcl2PropertyName)) {
-    for (const auto &device : manager.assembling().getProperty(common::constants::rpcl2PropertyName).devices) {
-      for (const auto &gen : manager.assembling().getSingleAssociation(device.id).generators) {
-        auto it = generatorsInSVC.find(gen.name);
-        if (it != generatorsInSVC.end())
-          generatorsInSVC[gen.name] = true;
-      }
-    }
-  }
-}
+    : generators_(gens), busesToNumberOfRegulationMap_(busesToNumberOfRegulationMap), assembling_(manager.assembling()),
+      useInfiniteReactivelimits_{infinitereactivelimits}, tfoVoltageLevel_(tfoVoltageLevel) {}
 
 void GeneratorDefinitionAlgorithm::operator()(const NodePtr &node, std::shared_ptr<AlgorithmsResults> &algoRes) {
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
@@ -89,9 +67,11 @@ void GeneratorDefinitionAlgorithm::operator()(const NodePtr &node, std::shared_p
       dfl::inputs::NetworkManager::BusMapRegulating::const_iterator it = busesToNumberOfRegulationMap_.find(generator.regulatedBusId);
       dfl::inputs::NetworkManager::NbOfRegulating nbOfRegulatingGenerators =
           (it != busesToNumberOfRegulationMap_.end()) ? it->second : dfl::inputs::NetworkManager::NbOfRegulating::ONE;
-      auto svcIt = generatorsInSVC.find(generator.id);
-      const bool isInSVC = svcIt != generatorsInSVC.end();
-      const bool isRPCL2 = isInSVC && svcIt->second;
+      const auto &automatons = assembling_.getAutomatonsFromElement(generator.id);
+      const bool isInSVC = std::any_of(automatons.begin(), automatons.end(), [](const inputs::AssemblingDataBase::ElementAutomaton &elementAutomaton) {
+        return elementAutomaton.automaton->lib == common::constants::svcModelName;
+      });
+      const bool isRPCL2 = isInSVC && assembling_.hasProperty(generator.id, common::constants::rpcl2PropertyName);
       model = ModelType::SIGNALN_INFINITE;
       algoRes->isAtLeastOneGeneratorRegulating = true;
 
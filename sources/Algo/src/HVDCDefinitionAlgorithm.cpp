@@ -24,21 +24,20 @@ HVDCDefinitionAlgorithm::HVDCDefinitionAlgorithm(HVDCLineDefinitions &hvdcLinesD
                                                  const std::unordered_set<std::shared_ptr<inputs::Converter>> &converters,
                                                  const inputs::DynamicDataBaseManager &manager)
     : hvdcLinesDefinitions_(hvdcLinesDefinitions), busesToNumberOfRegulationMap_(busesToNumberOfRegulationMap),
-      infiniteReactiveLimits_(infiniteReactiveLimits) {
+      infiniteReactiveLimits_(infiniteReactiveLimits), assembling_(manager.assembling()) {
   std::transform(converters.begin(), converters.end(), std::inserter(vscConverters_, vscConverters_.begin()),
                  [](const std::shared_ptr<inputs::Converter> &converter) { return std::make_pair(converter->busId, converter); });
-  for (const auto &automaton : manager.assembling().dynamicAutomatons()) {
-    if (automaton.second.lib == dfl::common::constants::svcModelName) {
-      for (const auto &macroConn : automaton.second.macroConnects) {
-        if (manager.assembling().isSingleAssociation(macroConn.id)) {
-          const auto &assoc = manager.assembling().getSingleAssociation(macroConn.id);
-          if (assoc.hvdcLine) {
-            hvdcLinesInSVC_[assoc.hvdcLine.get().name] = assoc.hvdcLine.get().converterStation1;
-          }
-        }
-      }
-    }
-  }
+}
+
+boost::optional<inputs::AssemblingDataBase::HvdcLineConverterSide> HVDCDefinitionAlgorithm::getSVCConverterSide(const std::string &hvdcLineId) const {
+  // the last secondary voltage control area of the assembling defines the side, as when the areas are read in order
+  const auto &automatons = assembling_.getAutomatonsFromElement(hvdcLineId);
+  const auto it = std::find_if(automatons.rbegin(), automatons.rend(), [](const inputs::AssemblingDataBase::ElementAutomaton &elementAutomaton) {
+    return elementAutomaton.automaton->lib == dfl::common::constants::svcModelName && elementAutomaton.singleAssociation->hvdcLine;
+  });
+  if (it == automatons.rend())
+    return boost::none;
+  return it->singleAssociation->hvdcLine->converterStation1;
 }
 
 auto HVDCDefinitionAlgorithm::computeModelVSC(const inputs::HvdcLine &hvdcline, HVDCDefinition::Position position,
@@ -80,9 +79,9 @@ auto HVDCDefinitionAlgorithm::computeModelVSC(const inputs::HvdcLine &hvdcline,
 
 auto HVDCDefinitionAlgorithm::computeModel(const inputs::HvdcLine &hvdcline, HVDCDefinition::Position position, inputs::HvdcLine::ConverterType type) const
     -> HVDCModelDefinition {
-  const auto &itHvdc = hvdcLinesInSVC_.find(hvdcline.id);
-  const bool isInSVC = itHvdc != hvdcLinesInSVC_.end();
-  const bool converterSide1 = isInSVC && itHvdc->second == inputs::AssemblingDataBase::HvdcLineConverterSide::SIDE1;
+  const auto svcConverterSide = getSVCConverterSide(hvdcline.id);
+  const bool isInSVC = svcConverterSide.is_initialized();
+  const bool converterSide1 = isInSVC && *svcConverterSide == inputs::AssemblingDataBase::HvdcLineConverterSide::SIDE1;
   if (position == HVDCDefinition::Position::BOTH_IN_MAIN_COMPONENT) {
     if (type == inputs::HvdcLine::ConverterType::LCC) {
       return HVDCModelDefinition{infiniteReactiveLimits_ ? HVDCDefinition::HVDCModel::HvdcPTanPhi : HVDCDefinition::HVDCModel::HvdcPTanPhiDiagramPQ};
@@ -139,7 +138,6 @@ auto HVDCDefinitionAlgorithm::computeModel(const inputs::HvdcLine &hvdcline, HVD
 std::pair<std::reference_wrapper<HVDCDefinition>, bool> HVDCDefinitionAlgorithm::getOrCreateHvdcLineDefinition(const inputs::HvdcLine &hvdcLine) {
   auto &hvdcLines = hvdcLinesDefinitions_.hvdcLines;
   auto it = hvdcLines.find(hvdcLine.id);
-  const auto &hvdcIt = hvdcLinesInSVC_.find(hvdcLine.id);
   bool alreadyInserted = it != hvdcLines.end();
   if (alreadyInserted) {
     return {std::ref(it->second), alreadyInserted};
@@ -163,11 +161,9 @@ std::pair<std::reference_wrapper<HVDCDefinition>, bool> HVDCDefinitionAlgorithm:
       voltageRegulation2 = converterVSC2->voltageRegulationOn;
     }
 
-    inputs::AssemblingDataBase::HvdcLineConverterSide side = inputs::AssemblingDataBase::HvdcLineConverterSide::SIDE1;  // by default
-    // side 1 of dynamic model is connected to the side 1 of the static model
-    if (hvdcIt != hvdcLinesInSVC_.end()) {
-      side = hvdcIt->second;
-    }
+    // side 1 of dynamic model is connected to the side 1 of the static model by default
+    inputs::AssemblingDataBase::HvdcLineConverterSide side =
+        getSVCConverterSide(hvdcLine.id).value_or(inputs::AssemblingDataBase::HvdcLineConverterSide::SIDE1);
     boost::optional<double> droop = (hvdcLine.activePowerControl) ? hvdcLine.activePowerControl->droop : boost::optional<double>();
     boost::optional<double> p0 = (hvdcLine.activePowerControl) ? hvdcLine.activePowerControl->p0 : boost::optional<double>();
     HVDCDefinition createdHvdcLine(hvdcLine.id, hvdcLine.converterType, hvdcLine.converter1->converterId, hvdcLine.converter1->busId, voltageRegulation1,
@@ -0,0 +1,163 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  LibraryProbeCache.cpp
+ *
+ * @brief Dynaflow launcher cache of the shared library probes implementation file
+ *
+ */
+
+#include "LibraryProbeCache.h"
+
+#include <fstream>
+#include <sstream>
+#include <type_traits>
+
+#ifdef __linux__
+#include <cstring>
+#include <elf.h>
+#endif
+
+namespace dfl {
+namespace algo {
+
+namespace helper {
+
+/// @brief First line of the cache file, identifying its format
+static const std::string header{"# dynaflow-launcher library probes: size lastWriteTime path"};
+
+#ifdef __linux__
+/// @brief ELF header of the class of the current process
+using ElfHeader = std::conditional<sizeof(void *) == 8, Elf64_Ehdr, Elf32_Ehdr>::type;
+
+/**
+ * @brief Read the ELF header of a file
+ *
+ * @param filepath the file to read
+ * @param elfHeader the header to fill
+ * @returns true if the file starts with an ELF header of the class and byte order of the current process, false if not
+ */
+static bool readElfHeader(const std::string &filepath, ElfHeader &elfHeader) {
+  std::ifstream ifs(filepath, std::ios::binary);
+  if (!ifs.read(reinterpret_cast<char *>(&elfHeader), sizeof(elfHeader))) {
+    return false;
+  }
+  const uint16_t one = 1;
+  const unsigned char hostData = (*reinterpret_cast<const unsigned char *>(&one) == 1) ? ELFDATA2LSB : ELFDATA2MSB;
+  const unsigned char hostClass = (sizeof(void *) == 8) ? ELFCLASS64 : ELFCLASS32;
+  return std::memcmp(elfHeader.e_ident, ELFMAG, SELFMAG) == 0 && elfHeader.e_ident[EI_CLASS] == hostClass && elfHeader.e_ident[EI_DATA] == hostData;
+}
+#endif
+
+}  // namespace helper
+
+LibraryProbeCache::LibraryProbeCache(const boost::filesystem::path &filepath) : filepath_(filepath) { read(filepath_, entries_); }
+
+void LibraryProbeCache::read(const boost::filesystem::path &filepath, std::unordered_map<std::string, Entry> &entries) {
+  std::ifstream ifs(filepath.generic_string());
+  std::string line;
+  if (!std::getline(ifs, line) || line != helper::header) {
+    return;
+  }
+  while (std::getline(ifs, line)) {
+    std::istringstream iss(line);
+    Entry entry;
+    std::string path;
+    // the path is last as it may contain spaces
+    if (iss >> entry.size >> entry.lastWriteTime && std::getline(iss >> std::ws, path) && !path.empty()) {
+      entries[path] = entry;
+    }
+  }
+}
+
+bool LibraryProbeCache::isLoadableHeader(const boost::filesystem::path &library) {
+#ifdef __linux__
+  helper::ElfHeader elfHeader;
+  if (!helper::readElfHeader(library.generic_string(), elfHeader) || elfHeader.e_type != ET_DYN) {
+    return false;
+  }
+  // the machine of the current process is the one of its executable
+  static const int hostMachine = []() {
+    helper::ElfHeader executableHeader;
+    return helper::readElfHeader("/proc/self/exe", executableHeader) ? static_cast<int>(executableHeader.e_machine) : -1;
+  }();
+  return static_cast<int>(elfHeader.e_machine) == hostMachine;
+#else
+  static_cast<void>(library);
+  return false;
+#endif
+}
+
+bool LibraryProbeCache::contains(const boost::filesystem::path &library) const {
+  auto found = entries_.find(library.generic_string());
+  if (found == entries_.end()) {
+    return false;
+  }
+  boost::system::error_code ec;
+  const uintmax_t size = boost::filesystem::file_size(library, ec);
+  if (ec || size != found->second.size) {
+    return false;
+  }
+  const std::time_t lastWriteTime = boost::filesystem::last_write_time(library, ec);
+  if (ec || lastWriteTime != found->second.lastWriteTime) {
+    return false;
+  }
+  return isLoadableHeader(library);
+}
+
+void LibraryProbeCache::add(const boost::filesystem::path &library) {
+  boost::system::error_code ec;
+  Entry entry;
+  entry.size = boost::filesystem::file_size(library, ec);
+  if (ec) {
+    return;
+  }
+  entry.lastWriteTime = boost::filesystem::last_write_time(library, ec);
+  if (ec) {
+    return;
+  }
+  entries_[library.generic_string()] = entry;
+  modified_ = true;
+}
+
+void LibraryProbeCache::write() const {
+  if (!modified_) {
+    return;
+  }
+  // entries written by concurrent processes are kept, the entries of the current process are the most recent ones
+  std::unordered_map<std::string, Entry> entries;
+  read(filepath_, entries);
+  for (const auto &entry : entries_) {
+    entries[entry.first] = entry.second;
+  }
+
+  if (filepath_.has_parent_path()) {
+    boost::filesystem::create_directories(filepath_.parent_path());
+  }
+  boost::filesystem::path tmpFilepath(filepath_.parent_path());
+  tmpFilepath /= boost::filesystem::unique_path(".tmp-%%%%-%%%%-%%%%-%%%%");
+  try {
+    std::ofstream ofs(tmpFilepath.generic_string());
+    ofs << helper::header << '\n';
+    for (const auto &entry : entries) {
+      ofs << entry.second.size << ' ' << entry.second.lastWriteTime << ' ' << entry.first << '\n';
+    }
+    ofs.close();
+    boost::filesystem::rename(tmpFilepath, filepath_);
+  } catch (...) {
+    boost::system::error_code ec;
+    boost::filesystem::remove(tmpFilepath, ec);
+    throw;
+  }
+}
+
+}  // namespace algo
+}  // namespace dfl
@@ -0,0 +1,74 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file Fingerprint.h
+ *
+ * @brief Dynaflow launcher fingerprint header file
+ *
+ */
+
+#pragma once
+
+#include <boost/filesystem.hpp>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+
+namespace dfl {
+namespace common {
+
+/**
+ * @brief Fingerprint of values or of the content of a file
+ *
+ * Values are serialized one after the other, each one preceded by its size, and hashed with SHA-256, which is stable across platforms and runs.
+ * Fingerprints are used as keys to reuse simulation results and compiled models: they must not collide, even for inputs built on purpose.
+ */
+class Fingerprint {
+ public:
+  /**
+   * @brief Add a value to the fingerprint
+   *
+   * @param value the value to add, which must be streamable
+   * @returns the current fingerprint
+   */
+  template<class T>
+  Fingerprint &operator<<(const T &value) {
+    std::ostringstream ss;
+    ss << std::setprecision(std::numeric_limits<double>::max_digits10) << value;
+    const std::string &serialized = ss.str();
+    stream_ << serialized.size() << ':' << serialized;
+    return *this;
+  }
+
+  /**
+   * @brief Retrieves the fingerprint value
+   *
+   * @returns the hexadecimal representation of the hash of all the added values
+   */
+  std::string str() const;
+
+  /**
+   * @brief Computes the fingerprint of the content of a file
+   *
+   * The file is read by chunks, so that large files are not loaded in memory. A missing file has the fingerprint of an empty content.
+   *
+   * @param filepath the path of the file
+   * @returns the hexadecimal representation of the hash of the content of the file
+   */
+  static std::string ofFile(const boost::filesystem::path &filepath);
+
+ private:
+  std::ostringstream stream_;  ///< serialized values
+};
+
+}  // namespace common
+}  // namespace dfl
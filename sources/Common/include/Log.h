@@ -49,6 +49,14 @@ class Log {
    * @param outputDir directory where the log should be written
    */
   static void init(const common::Options& options, const std::string& outputDir);
+
+  /**
+   * @brief Load the dynawo and dynaflow launcher dictionaries from the runtime environment
+   *
+   * Used by the command line tools, for which the runtime environment is optional: nothing is loaded
+   * if one of DYNAWO_RESOURCES_DIR, DYNAWO_DICTIONARIES or DYNAFLOW_LAUNCHER_LOCALE is not set
+   */
+  static void initDictionaries();
 };
 
 }  // namespace common
@@ -44,6 +44,7 @@ class Options {
     std::string contingenciesFilePath;  ///< Contingencies filepath for security analysis
     std::string configPath;             ///< Launcher configuration filepath
     std::string dynawoLogLevel;         ///< chosen log level
+    bool resume;                        ///< resume an interrupted security analysis
   };
 
   /**
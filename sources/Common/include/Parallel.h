@@ -0,0 +1,41 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file Parallel.h
+ *
+ * @brief Dynaflow launcher parallel tasks header file
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace dfl {
+namespace common {
+
+/**
+ * @brief Run independent tasks on a pool of worker threads
+ *
+ * Each worker takes the next task not yet started as soon as it is done with the previous one, so that long tasks do not keep
+ * the other workers idle. When a task throws, no further task is started and, once all workers are done, the exception of the failed task
+ * of lowest index is rethrown. Tasks being started in the order of their indexes, the rethrown exception does not depend on the timing
+ * of the tasks.
+ *
+ * @param nbTasks the number of tasks
+ * @param nbWorkers the number of worker threads, tasks are run in the calling thread if it is 1 or less
+ * @param task the function running the task of the given index
+ */
+void runParallel(std::size_t nbTasks, unsigned int nbWorkers, const std::function<void(std::size_t)> &task);
+
+}  // namespace common
+}  // namespace dfl
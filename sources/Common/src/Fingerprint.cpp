@@ -0,0 +1,162 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Fingerprint.cpp
+ *
+ * @brief Dynaflow launcher fingerprint implementation file
+ *
+ */
+
+#include "Fingerprint.h"
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace dfl {
+namespace common {
+
+namespace helper {
+
+/// @brief Round constants of SHA-256
+static const std::array<uint32_t, 64> sha256RoundConstants = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be,
+    0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa,
+    0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85,
+    0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f,
+    0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+/**
+ * @brief SHA-256 hash, as specified by FIPS 180-4
+ *
+ * None of the dependencies exposes a cryptographic hash: it is computed here, so that a collision of fingerprints cannot be obtained on purpose
+ */
+class Sha256 {
+ public:
+  /// @brief Constructor
+  Sha256() : state_{{0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19}}, length_(0), blockSize_(0) {}
+
+  /**
+   * @brief Hash bytes
+   *
+   * @param data the bytes to hash
+   * @param size the number of bytes
+   */
+  void update(const char *data, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+      block_[blockSize_++] = static_cast<unsigned char>(data[i]);
+      if (blockSize_ == block_.size()) {
+        compress();
+        blockSize_ = 0;
+      }
+    }
+    length_ += size;
+  }
+
+  /**
+   * @brief Finish the hash
+   *
+   * @returns the hexadecimal representation of the hash of all the bytes
+   */
+  std::string final() {
+    const uint64_t nbBits = length_ * 8;
+    const char padding = static_cast<char>(0x80);
+    update(&padding, 1);
+    const char zero = 0;
+    while (blockSize_ != 56) {
+      update(&zero, 1);
+    }
+    for (int shift = 56; shift >= 0; shift -= 8) {
+      const char byte = static_cast<char>((nbBits >> shift) & 0xff);
+      update(&byte, 1);
+    }
+    std::ostringstream ss;
+    for (auto word : state_) {
+      ss << std::hex << std::setw(8) << std::setfill('0') << word;
+    }
+    return ss.str();
+  }
+
+ private:
+  /**
+   * @brief Rotate a word to the right
+   *
+   * @param value the word to rotate
+   * @param nbBits the number of bits of the rotation
+   * @returns the rotated word
+   */
+  static uint32_t rotate(uint32_t value, unsigned int nbBits) { return (value >> nbBits) | (value << (32 - nbBits)); }
+
+  /// @brief Hash the current block
+  void compress() {
+    std::array<uint32_t, 64> words;
+    for (std::size_t i = 0; i < 16; ++i) {
+      words[i] = (static_cast<uint32_t>(block_[4 * i]) << 24) | (static_cast<uint32_t>(block_[4 * i + 1]) << 16) |
+                 (static_cast<uint32_t>(block_[4 * i + 2]) << 8) | static_cast<uint32_t>(block_[4 * i + 3]);
+    }
+    for (std::size_t i = 16; i < words.size(); ++i) {
+      const uint32_t s0 = rotate(words[i - 15], 7) ^ rotate(words[i - 15], 18) ^ (words[i - 15] >> 3);
+      const uint32_t s1 = rotate(words[i - 2], 17) ^ rotate(words[i - 2], 19) ^ (words[i - 2] >> 10);
+      words[i] = words[i - 16] + s0 + words[i - 7] + s1;
+    }
+    std::array<uint32_t, 8> v = state_;
+    for (std::size_t i = 0; i < words.size(); ++i) {
+      const uint32_t s1 = rotate(v[4], 6) ^ rotate(v[4], 11) ^ rotate(v[4], 25);
+      const uint32_t choice = (v[4] & v[5]) ^ (~v[4] & v[6]);
+      const uint32_t temp1 = v[7] + s1 + choice + sha256RoundConstants[i] + words[i];
+      const uint32_t s0 = rotate(v[0], 2) ^ rotate(v[0], 13) ^ rotate(v[0], 22);
+      const uint32_t majority = (v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]);
+      const uint32_t temp2 = s0 + majority;
+      v[7] = v[6];
+      v[6] = v[5];
+      v[5] = v[4];
+      v[4] = v[3] + temp1;
+      v[3] = v[2];
+      v[2] = v[1];
+      v[1] = v[0];
+      v[0] = temp1 + temp2;
+    }
+    for (std::size_t i = 0; i < state_.size(); ++i) {
+      state_[i] += v[i];
+    }
+  }
+
+  std::array<uint32_t, 8> state_;        ///< current hash value
+  std::array<unsigned char, 64> block_;  ///< current block
+  uint64_t length_;                      ///< number of hashed bytes, padding excluded
+  std::size_t blockSize_;                ///< number of bytes in the current block
+};
+
+}  // namespace helper
+
+std::string Fingerprint::str() const {
+  const std::string &values = stream_.str();
+  helper::Sha256 hash;
+  hash.update(values.data(), values.size());
+  return hash.final();
+}
+
+std::string Fingerprint::ofFile(const boost::filesystem::path &filepath) {
+  std::ifstream ifs(filepath.generic_string(), std::ios::binary);
+  helper::Sha256 hash;
+  std::array<char, 65536> buffer;
+  while (ifs) {
+    ifs.read(buffer.data(), buffer.size());
+    hash.update(buffer.data(), static_cast<std::size_t>(ifs.gcount()));
+  }
+  return hash.final();
+}
+
+}  // namespace common
+}  // namespace dfl
@@ -15,7 +15,9 @@
 
 #include "Log.h"
 
+#include <DYNIoDico.h>
 #include <boost/filesystem.hpp>
+#include <cstdlib>
 
 namespace file = boost::filesystem;
 
@@ -53,5 +55,20 @@ Log::init(const common::Options& options, const std::string& outputDir) {
   Trace::clearAndAddAppenders(appenders);
 }
 
+void
+Log::initDictionaries() {
+  const char* resourcesDir = getenv("DYNAWO_RESOURCES_DIR");
+  const char* dictionaries = getenv("DYNAWO_DICTIONARIES");
+  const char* locale = getenv("DYNAFLOW_LAUNCHER_LOCALE");
+  if (resourcesDir == NULL || dictionaries == NULL || locale == NULL) {
+    return;
+  }
+  DYN::IoDicos& dicos = DYN::IoDicos::instance();
+  dicos.addPath(resourcesDir);
+  dicos.addDicos(dictionaries, locale);
+  dicos.addDico("DFLLOG", "DFLLog", locale);
+  dicos.addDico("DFLERROR", "DFLError", locale);
+}
+
 }  // namespace common
 }  // namespace dfl
@@ -81,14 +81,16 @@ Options::basename(const std::string& filepath) {
   return path.filename().replace_extension().generic_string();
 }
 
-Options::Options() : desc_{}, config_{"", "", "", "", defaultLogLevel_} {
+Options::Options() : desc_{}, config_{"", "", "", "", defaultLogLevel_, false} {
   desc_.add_options()("help,h", "Display help message")(
       "log-level", po::value<ParsedLogLevel>(),
       (std::string("Dynawo logger level (allowed values are ERROR, WARN, INFO, DEBUG): default is ") + defaultLogLevel_).c_str())(
       "network", po::value<std::string>(&config_.networkFilePath)->required(), "Network file path to process (IIDM support only)")(
       "contingencies", po::value<std::string>(&config_.contingenciesFilePath), "Contingencies file path to process (Security Analysis)")(
       "config", po::value<std::string>(&config_.configPath)->required(), "launcher Configuration file to use")("version,v", "Display version")(
-      "nsa", "Run steady state calculation followed by security analysis. Requires contingencies file to be defined.");
+      "nsa", "Run steady state calculation followed by security analysis. Requires contingencies file to be defined.")(
+      "resume", "Resume an interrupted security analysis, simulating only the contingencies not yet simulated with the same inputs. Requires "
+                "contingencies file to be defined.");
 }
 
 Options::Request
@@ -112,6 +114,10 @@ Options::parse(int argc, char* argv[]) {
     if (vm.count("log-level") > 0) {
       config_.dynawoLogLevel = vm["log-level"].as<ParsedLogLevel>().logLevelDefinition;
     }
+    config_.resume = vm.count("resume") > 0;
+    if (config_.resume && vm.count("contingencies") == 0) {
+      return Request::ERROR;
+    }
 
     if (vm.count("nsa") > 0) {
       if (vm.count("contingencies") > 0) {
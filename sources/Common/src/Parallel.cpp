@@ -0,0 +1,70 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Parallel.cpp
+ *
+ * @brief Dynaflow launcher parallel tasks implementation file
+ *
+ */
+
+#include "Parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace dfl {
+namespace common {
+
+void runParallel(std::size_t nbTasks, unsigned int nbWorkers, const std::function<void(std::size_t)> &task) {
+  if (nbWorkers <= 1 || nbTasks <= 1) {
+    for (std::size_t index = 0; index < nbTasks; ++index) {
+      task(index);
+    }
+    return;
+  }
+
+  std::atomic<std::size_t> nextTask(0);
+  std::atomic<bool> failed(false);
+  // one slot per task, so that the reported error does not depend on which task failed first in time
+  std::vector<std::exception_ptr> errors(nbTasks);
+  auto worker = [&]() {
+    std::size_t index;
+    while (!failed && (index = nextTask++) < nbTasks) {
+      try {
+        task(index);
+      } catch (...) {
+        errors[index] = std::current_exception();
+        failed = true;
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  const auto nbThreads = std::min<std::size_t>(nbWorkers, nbTasks);
+  workers.reserve(nbThreads);
+  for (std::size_t i = 0; i < nbThreads; ++i) {
+    workers.emplace_back(worker);
+  }
+  for (auto &thread : workers) {
+    thread.join();
+  }
+  for (const auto &error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+}  // namespace common
+}  // namespace dfl
@@ -19,37 +19,201 @@
 
 #include "Constants.h"
 #include "Contingencies.h"
+#include "ContingenciesArchive.h"
+#include "ContingenciesHistory.h"
 #include "Diagram.h"
 #include "Dyd.h"
 #include "DydEvent.h"
 #include "DynModelFilterAlgorithm.h"
+#include "Fingerprint.h"
 #include "Job.h"
 #include "Log.h"
+#include "Manifest.h"
 #include "Network.h"
+#include "OutputsConstants.h"
 #include "Par.h"
 #include "ParEvent.h"
+#include "Parallel.h"
+#include "ProgressJournal.h"
+#include "ResultCache.h"
 #include "Solver.h"
 
+#include <AGGRESXmlExporter.h>
 #include <DYNMultiProcessingContext.h>
 #include <DYNMultipleJobsFactory.h>
 #include <DYNScenario.h>
 #include <DYNScenarios.h>
 #include <DYNSimulation.h>
 #include <DYNSimulationContext.h>
+#include <DYNSimulationResult.h>
 #include <DYNSystematicAnalysisLauncher.h>
 #include <DYNTimer.h>
+#include <JOBDynModelsEntryFactory.h>
+#include <JOBModelerEntry.h>
+#include <JOBSolverEntry.h>
 #include <algorithm>
 #include <boost/filesystem.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/xml_parser.hpp>
+#include <chrono>
+#include <cmath>
+#include <config_dynawo.h>
+#include <deque>
+#include <libxml/parser.h>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
 #include <tuple>
 
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 namespace file = boost::filesystem;
 
 namespace dfl {
-Context::Context(const ContextDef &def, inputs::Configuration &config)
-    : def_(def), networkManager_(def.networkFilepath), dynamicDataBaseManager_(def.settingFilePath, def.assemblingFilePath),
-      contingenciesManager_(def.contingenciesFilePath),
+
+namespace helper {
+
+/// @brief Statuses of the contingency simulations of the launcher, with their string representation
+static const std::vector<std::pair<DYNAlgorithms::status_t, std::string>> simulationStatuses{
+    {DYNAlgorithms::CONVERGENCE_STATUS, "CONVERGENCE"},
+    {DYNAlgorithms::DIVERGENCE_STATUS, "DIVERGENCE"},
+    {DYNAlgorithms::EXECUTION_PROBLEM_STATUS, "EXECUTION_PROBLEM"}};
+
+/**
+ * @brief Converts a simulation status to its string representation
+ *
+ * @param status the status to convert
+ * @returns the string representation of the status, as written in the aggregated results
+ */
+static std::string toString(DYNAlgorithms::status_t status) {
+  for (const auto &simulationStatus : simulationStatuses) {
+    if (simulationStatus.first == status) {
+      return simulationStatus.second;
+    }
+  }
+  return "EXECUTION_PROBLEM";
+}
+
+/**
+ * @brief Converts a string representation to a simulation status
+ *
+ * @param str the string representation of the status
+ * @param status the converted status
+ * @returns false if the string is not the representation of a status of the launcher simulations
+ */
+static bool fromString(const std::string &str, DYNAlgorithms::status_t &status) {
+  for (const auto &simulationStatus : simulationStatuses) {
+    if (simulationStatus.second == str) {
+      status = simulationStatus.first;
+      return true;
+    }
+  }
+  return false;
+}
+
+/// @brief Status of the contingency simulations aborted once their wall-clock budget is spent
+static const std::string timeoutStatus{"TIMEOUT"};
+
+/**
+ * @brief Read the results of the scenarios of an aggregated results file
+ *
+ * @param aggregatedResults the path of the aggregated results file
+ * @returns the element of each scenario, by scenario id
+ */
+static std::map<std::string, boost::property_tree::ptree> readScenarioResults(const boost::filesystem::path &aggregatedResults) {
+  std::map<std::string, boost::property_tree::ptree> scenarioResults;
+  boost::property_tree::ptree resultsTree;
+  boost::property_tree::read_xml(aggregatedResults.generic_string(), resultsTree, boost::property_tree::xml_parser::trim_whitespace);
+  for (const auto &root : resultsTree) {
+    for (const auto &scenario : root.second) {
+      const std::string &tag = scenario.first;
+      auto id = scenario.second.get_optional<std::string>("<xmlattr>.id");
+      if (tag.substr(tag.find(':') + 1) == "scenarioResults" && id) {
+        scenarioResults[*id] = scenario.second;
+      }
+    }
+  }
+  return scenarioResults;
+}
+
+/**
+ * @brief Retrieves the fingerprint of the inputs of a contingency
+ *
+ * @param fingerprints the fingerprint of the inputs of each contingency, by id
+ * @param contingencyId the id of the contingency
+ * @returns the fingerprint of the contingency, empty if unknown
+ */
+static std::string fingerprintOf(const std::map<std::string, std::string> &fingerprints, const std::string &contingencyId) {
+  auto fingerprint = fingerprints.find(contingencyId);
+  return (fingerprint != fingerprints.end()) ? fingerprint->second : std::string();
+}
+
+/**
+ * @brief Add the descriptions of the models compiled by Dynawo of a DYD file to a fingerprint
+ *
+ * @param fingerprint the fingerprint to update
+ * @param dydPath the DYD file
+ */
+static void addCompiledModels(common::Fingerprint &fingerprint, const file::path &dydPath) {
+  static const std::set<std::string> compiledModels{"modelicaModel", "modelTemplate", "modelTemplateExpansion"};
+  boost::property_tree::ptree dydTree;
+  boost::property_tree::read_xml(dydPath.generic_string(), dydTree, boost::property_tree::xml_parser::trim_whitespace);
+  for (const auto &root : dydTree) {
+    for (const auto &model : root.second) {
+      const std::string &tag = model.first;
+      if (compiledModels.count(tag.substr(tag.find(':') + 1)) > 0) {
+        // the model is written under its tag, so that its attributes are kept
+        boost::property_tree::ptree modelTree;
+        modelTree.push_back(model);
+        std::ostringstream description;
+        boost::property_tree::write_xml(description, modelTree);
+        fingerprint << description.str();
+      }
+    }
+  }
+}
+
+}  // namespace helper
+
+Context::Context(const ContextDef &def, inputs::Configuration &config) : Context(def, config, loadInputs(def)) {}
+
+Context::LoadedInputs Context::loadInputs(const ContextDef &def) {
+#if defined(_DEBUG_) || defined(PRINT_TIMERS)
+  DYN::Timer timer("DFL::Context::loadInputs()");
+#endif
+  // libxml2 must be initialized by a single thread before parsing files on several threads
+  xmlInitParser();
+
+  LoadedInputs loadedInputs;
+  // the tasks are indexed in the order in which their errors are reported
+  common::runParallel(3, 3, [&def, &loadedInputs](std::size_t index) {
+    switch (index) {
+    case 0:
+      loadedInputs.networkManager.emplace(def.networkFilepath);
+      break;
+    case 1:
+      loadedInputs.dynamicDataBaseManager.emplace(def.settingFilePath, def.assemblingFilePath);
+      break;
+    default:
+      loadedInputs.contingenciesManager.emplace(def.contingenciesFilePath);
+      break;
+    }
+  });
+  return loadedInputs;
+}
+
+Context::Context(const ContextDef &def, inputs::Configuration &config, LoadedInputs &&loadedInputs)
+    : def_(def), networkManager_(std::move(*loadedInputs.networkManager)), dynamicDataBaseManager_(std::move(*loadedInputs.dynamicDataBaseManager)),
+      contingenciesManager_(std::move(*loadedInputs.contingenciesManager)),
       config_(config), basename_{}, slackNode_{}, slackNodeOrigin_{SlackNodeOrigin::ALGORITHM}, generators_{}, loads_{}, staticVarCompensators_{},
       algoResults_(new algo::AlgorithmsResults()), jobEntry_{}, jobsEvents_{} {
   file::path path(def.networkFilepath);
@@ -121,7 +285,22 @@ bool Context::process() {
   onNodeOnMainConnexComponent(algo::LoadDefinitionAlgorithm(loads_, config_.getDsoVoltageLevel()));
   onNodeOnMainConnexComponent(algo::HVDCDefinitionAlgorithm(hvdcLineDefinitions_, networkManager_.getBusRegulationMap(), config_.useInfiniteReactiveLimits(),
                                                             networkManager_.computeVSCConverters(), dynamicDataBaseManager_));
-  onNodeOnMainConnexComponent(algo::DynModelAlgorithm(dynamicModels_, dynamicDataBaseManager_, config_.isShuntRegulationOn()));
+  boost::optional<algo::LibraryProbeCache> libraryProbeCache;
+  if (!config_.libraryProbeCacheFile().empty()) {
+    libraryProbeCache.emplace(config_.libraryProbeCacheFile());
+  }
+  auto dynModelAlgorithm =
+      std::make_shared<algo::DynModelAlgorithm>(dynamicModels_, dynamicDataBaseManager_, config_.isShuntRegulationOn(), libraryProbeCache.get_ptr());
+  onNodeOnMainConnexComponent([dynModelAlgorithm](const std::shared_ptr<inputs::Node> &node, std::shared_ptr<algo::AlgorithmsResults> &algoRes) {
+    (*dynModelAlgorithm)(node, algoRes);
+  });
+  if (libraryProbeCache) {
+    try {
+      libraryProbeCache->write();
+    } catch (const std::exception &e) {
+      LOG(warn, LibraryProbeCacheFailed, e.what());
+    }
+  }
 
   if (config_.isSVarCRegulationOn()) {
     onNodeOnMainConnexComponent(algo::StaticVarCompensatorAlgorithm(staticVarCompensators_));
@@ -132,9 +311,11 @@ bool Context::process() {
     if (!contingencies.empty()) {
       validContingencies_ = boost::make_optional(algo::ValidContingencies(contingencies));
       onNodeOnMainConnexComponent(algo::ContingencyValidationAlgorithmOnNodes(*validContingencies_));
+      onNodeOnMainConnexComponent(algo::ContingencyCostAlgorithm(contingencyCosts_));
     }
   }
   walkNodesMain();
+  dynModelAlgorithm->storeMacroConnections();
 
   algo::DynModelFilterAlgorithm dynModelFilterAlgorithm(dynamicDataBaseManager_.assembling(), generators_, dynamicModels_.models);
   dynModelFilterAlgorithm.filter();
@@ -174,18 +355,24 @@ void Context::exportOutputs() {
   if (!mpiContext.isRootProc())
     return;
 
+  // Files whose inputs did not change since the previous run are kept as is in incremental export
+  outputs::Manifest manifest(config_.outputDir(), config_.isIncrementalExportOn());
+
   // Dyd
   file::path dydOutput(config_.outputDir());
   dydOutput.append(basename_ + ".dyd");
   outputs::Dyd dydWriter(outputs::Dyd::DydDefinition(basename_, dydOutput.generic_string(), generators_, loads_, slackNode_, hvdcLineDefinitions_,
                                                      networkManager_.getBusRegulationMap(), dynamicDataBaseManager_, dynamicModels_, staticVarCompensators_));
   dydWriter.write();
+  manifest.updateWritten(dydOutput);
 
   // create Network.par
   file::path networkOutput(config_.outputDir());
   networkOutput.append("Network.par");
   outputs::Network networkWriter(outputs::Network::NetworkDefinition(networkOutput, config_.getStartingPointMode()));
-  networkWriter.write();
+  if (manifest.update(networkOutput, networkWriter.fingerprint())) {
+    networkWriter.write();
+  }
 
   // create specific par
   file::path parOutput(config_.outputDir());
@@ -194,19 +381,44 @@ void Context::exportOutputs() {
                                                      dynamicDataBaseManager_, counters_, dynamicModels_, linesById_, tfosById_, staticVarCompensators_,
                                                      loads_));
   parWriter.write();
+  manifest.updateWritten(parOutput);
 
   // Diagram
   file::path diagramDirectory(config_.outputDir());
   diagramDirectory.append(basename_ + common::constants::diagramDirectorySuffix);
   outputs::Diagram diagramWriter(outputs::Diagram::DiagramDefinition(basename_, diagramDirectory.generic_string(), generators_, hvdcLineDefinitions_));
-  diagramWriter.write();
+  diagramWriter.write(manifest);
 
-  outputs::Solver solverWriter{dfl::outputs::Solver::SolverDefinition(config_)};
-  solverWriter.write();
+  file::path solverOutput(config_.outputDir());
+  solverOutput.append(outputs::constants::solverParFileName);
+  outputs::Solver::NetworkStatistics networkStatistics;
+  networkStatistics.nbBuses = mainConnexNodes_.size();
+  networkStatistics.nbRegulatingGenerators =
+      std::count_if(generators_.begin(), generators_.end(), [](const algo::GeneratorDefinition &generator) { return !generator.isNetwork(); });
+  networkStatistics.nbHvdcLines = hvdcLineDefinitions_.hvdcLines.size();
+  networkStatistics.hasSecondaryVoltageControl = dynamicDataBaseAssemblingContainsSVC();
+  if (config_.isSolverAutoTuningOn()) {
+    LOG(info, SolverAutoTuning, networkStatistics.nbBuses, networkStatistics.nbRegulatingGenerators, networkStatistics.nbHvdcLines);
+  }
+  outputs::Solver solverWriter{dfl::outputs::Solver::SolverDefinition(config_, networkStatistics)};
+  if (manifest.update(solverOutput, solverWriter.fingerprint())) {
+    solverWriter.write();
+  }
 
   if (def_.simulationKind == dfl::inputs::Configuration::SimulationKind::SECURITY_ANALYSIS) {
-    exportOutputsContingencies();
+    // Inputs shared by all the contingencies, recorded in the contingencies history and keying the results cache
+    // Input files are fingerprinted by content, so that the same network exported again gives the same fingerprint
+    common::Fingerprint inputsFingerprint;
+    inputsFingerprint << manifest.fingerprint(dydOutput) << manifest.fingerprint(networkOutput) << manifest.fingerprint(parOutput)
+                      << manifest.fingerprint(solverOutput) << config_.getStartTime() << config_.getStopTime() << config_.getTimeStep();
+    inputsFingerprint << common::Fingerprint::ofFile(def_.networkFilepath);
+    if (!config_.startingDumpFilePath().empty()) {
+      inputsFingerprint << common::Fingerprint::ofFile(config_.startingDumpFilePath());
+    }
+    exportOutputsContingencies(manifest, inputsFingerprint.str());
   }
+
+  manifest.write();
 }
 
 void Context::exportOutputJob() {
@@ -233,15 +445,16 @@ void Context::exportOutputJob() {
   }
 }
 
-void Context::exportOutputsContingencies() {
+void Context::exportOutputsContingencies(outputs::Manifest &manifest, const std::string &inputsFingerprint) {
   if (validContingencies_) {
     for (const auto &contingency : validContingencies_->get()) {
-      exportOutputsContingency(contingency, validContingencies_->getNetworkElements());
+      exportOutputsContingency(contingency, validContingencies_->getNetworkElements(), manifest, inputsFingerprint);
     }
   }
 }
 
-void Context::exportOutputsContingency(const inputs::Contingency &contingency, const std::unordered_set<std::string> &networkElements) {
+void Context::exportOutputsContingency(const inputs::Contingency &contingency, const std::unordered_set<std::string> &networkElements,
+                                       outputs::Manifest &manifest, const std::string &inputsFingerprint) {
   // Prepare a DYD, PAR and JOBS for every contingency
   // The DYD and PAR contain the definition of the events of the contingency
 
@@ -252,14 +465,22 @@ void Context::exportOutputsContingency(const inputs::Contingency &contingency, c
   file::path dydEvent(config_.outputDir());
   dydEvent.append(basenameEvent + ".dyd");
   outputs::DydEvent dydEventWriter(outputs::DydEvent::DydEventDefinition(basenameEvent, dydEvent.generic_string(), contingency, networkElements));
-  dydEventWriter.write();
+  if (manifest.update(dydEvent, dydEventWriter.fingerprint())) {
+    dydEventWriter.write();
+  }
 
   // Specific PAR for contingency
   file::path parEvent(config_.outputDir());
   parEvent.append(basenameEvent + ".par");
   outputs::ParEvent parEventWriter(
       outputs::ParEvent::ParEventDefinition(basenameEvent, parEvent.generic_string(), contingency, networkElements, config_.getTimeOfEvent()));
-  parEventWriter.write();
+  if (manifest.update(parEvent, parEventWriter.fingerprint())) {
+    parEventWriter.write();
+  }
+
+  common::Fingerprint contingencyFingerprint;
+  contingencyFingerprint << inputsFingerprint << manifest.fingerprint(dydEvent) << manifest.fingerprint(parEvent);
+  contingenciesFingerprints_[contingency.id] = contingencyFingerprint.str();
 
 #if _DEBUG_
   // A JOBS file for every contingency is produced only in DEBUG mode
@@ -282,6 +503,7 @@ void Context::execute() {
   auto path = file::canonical(inputPath);
   simu_context->setInputDirectory(path.generic_string());
   simu_context->setWorkingDirectory(config_.outputDir().generic_string());
+  openCompilationCache();
 
   switch (def_.simulationKind) {
   case dfl::inputs::Configuration::SimulationKind::STEADY_STATE_CALCULATION: {
@@ -291,8 +513,12 @@ void Context::execute() {
     LOG(info, SimulateInfo, basename_);
 
     // For a power flow calculation it is ok to directly run here a single simulation
+    // The simulation reads the DYD and PAR files exported in the output directory: the Dynawo simulation API only accepts
+    // dynamic models and parameters through the files referenced by the job entry, so they cannot be handed over in memory
+    restoreCompiledModels(config_.outputDir());
     auto simu = boost::make_shared<DYN::Simulation>(jobEntry_, simu_context, networkManager_.dataInterface());
     simu->init();
+    storeCompiledModels(config_.outputDir());
     try {
       simu->simulate();
     } catch (const DYN::Error &err) {
@@ -329,32 +555,635 @@ void Context::execute() {
     break;
   }
   }
+
+  if (compilationCache_) {
+    try {
+      compilationCache_->evict();
+    } catch (const std::exception &e) {
+      LOG(warn, CompilationCacheFailed, e.what());
+    }
+  }
+}
+
+void Context::openCompilationCache() {
+  if (config_.compilationCacheDir().empty()) {
+    return;
+  }
+  // Only the modelica models and the model templates of the DYD file are compiled, by the compiler of the Dynawo installation: the black
+  // boxes are precompiled libraries and the parameters of the models are only set at runtime
+  file::path dydPath(config_.outputDir());
+  dydPath.append(basename_ + ".dyd");
+  common::Fingerprint key;
+  key << DYNAWO_VERSION_STRING;
+  try {
+    helper::addCompiledModels(key, dydPath);
+  } catch (const boost::property_tree::ptree_error &e) {
+    LOG(warn, CompilationCacheFailed, e.what());
+    return;
+  }
+  compilationCacheKey_ = key.str();
+  compilationCache_.reset(
+      new outputs::CompilationCache(config_.compilationCacheDir(), static_cast<uint64_t>(config_.getCompilationCacheMaxSize()) * 1024 * 1024));
+}
+
+void Context::restoreCompiledModels(const boost::filesystem::path &workingDirectory) const {
+  if (!compilationCache_) {
+    return;
+  }
+  try {
+    compilationCache_->restore(compilationCacheKey_, workingDirectory / outputs::constants::compilationDirectoryName);
+  } catch (const std::exception &e) {
+    LOG(warn, CompilationCacheFailed, e.what());
+  }
+}
+
+void Context::storeCompiledModels(const boost::filesystem::path &workingDirectory) const {
+  if (!compilationCache_) {
+    return;
+  }
+  try {
+    compilationCache_->store(compilationCacheKey_, workingDirectory / outputs::constants::compilationDirectoryName);
+  } catch (const std::exception &e) {
+    LOG(warn, CompilationCacheFailed, e.what());
+  }
 }
 
 void Context::executeSecurityAnalysis() {
-  // For security analysis we run multiple simulations using dynawo-algorithms
-  // Create one scenario for the base case and one scenario for each contingency
-  auto scenarios = boost::make_shared<DYNAlgorithms::Scenarios>();
-  scenarios->setJobsFile(jobEntry_->getName() + ".jobs");
-  if (validContingencies_) {
-    for (const auto &contingencyRef : validContingencies_->get()) {
+  // Longest expected simulations are started first, so that a long simulation does not end up running alone at the end
+  const auto &history = readContingenciesDurations();
+  static const std::vector<inputs::Contingency> noContingencies;
+  const auto &contingencies = validContingencies_ ? validContingencies_->get() : noContingencies;
+  const auto &expected = contingencyCosts_.estimate(contingencies, slackNode_, history);
+  const auto &order = algo::ContingencyCosts::longestFirst(contingencies, expected);
+  for (auto index : order) {
+    LOG(info, ContingencySimulationDefined, contingencies[index].id);
+  }
+
+  auto &mpiContext = DYNAlgorithms::multiprocessing::context();
+  bool inProcess = config_.getNbProcesses() > 0 && mpiContext.nbProcs() == 1;
+  if (config_.getNbProcesses() > 0 && !inProcess) {
+    // MPI processes already share the scenarios
+    LOG(warn, SecurityAnalysisProcessesIgnored, config_.getNbProcesses(), mpiContext.nbProcs());
+  }
+#if defined(_WIN32) || defined(_MPI_)
+  if (inProcess) {
+    // the contingencies are simulated in forked processes, which cannot be created on Windows nor once MPI is initialized
+    LOG(warn, SecurityAnalysisProcessesUnavailable, config_.getNbProcesses());
+    inProcess = false;
+  }
+#endif
+  if (config_.getScenarioTimeout() > 0. && !inProcess) {
+    // dynawo-algorithms simulates the scenarios until their end, neither the jobs file nor its launcher can abort them
+    LOG(warn, ScenarioTimeoutIgnored);
+  }
+  if (!inProcess && mpiContext.isRootProc()) {
+    // the durations of the scenarios simulated by dynawo-algorithms are not known
+    LOG(info, ContingenciesCostsUnavailable, mpiContext.nbProcs());
+  }
+
+  SecurityAnalysisProgress progress;
+  for (const auto &contingency : contingencies) {
+    progress.contingencyIds.push_back(contingency.id);
+  }
+  progress.statuses.resize(contingencies.size());
+  progress.durations.assign(contingencies.size(), -1.);
+  progress.solverProfiles.assign(contingencies.size(), 0);
+  progress.launcherResults.resize(contingencies.size());
+  if (mpiContext.isRootProc()) {
+    file::path journalPath(config_.outputDir());
+    journalPath.append(outputs::constants::progressJournalFileName);
+    progress.journal.reset(new outputs::ProgressJournal(journalPath, def_.resume));
+    if (!config_.resultCacheDir().empty()) {
+      progress.resultCache.reset(
+          new outputs::ResultCache(config_.resultCacheDir(), static_cast<uint64_t>(config_.getResultCacheMaxSize()) * 1024 * 1024));
+      isResultCacheUsed_ = true;
+    }
+  }
+
+  // Contingencies already simulated with the same inputs by an interrupted run, or found in the results cache, are not simulated again,
+  // whichever way the other ones are simulated
+  auto pending = reuseContingenciesResults(order, progress);
+  if (inProcess) {
+    executeSecurityAnalysisInProcess(config_.getNbProcesses(), pending, progress);
+  } else {
+    executeSecurityAnalysisWithLauncher(pending, progress);
+  }
+
+  if (mpiContext.isRootProc()) {
+    exportAggregatedResults(progress);
+    if (progress.resultCache) {
+      try {
+        progress.resultCache->evict();
+      } catch (const std::exception &e) {
+        LOG(warn, ResultCacheFailed, e.what());
+      }
+    }
+
+    algo::ContingencyCosts::Costs measured;
+    for (std::size_t index = 0; index < progress.contingencyIds.size(); ++index) {
+      if (progress.durations[index] >= 0.) {
+        measured[progress.contingencyIds[index]] = progress.durations[index];
+      }
+      if (progress.solverProfiles[index] > 0) {
+        contingenciesSolverProfiles_[progress.contingencyIds[index]] = progress.solverProfiles[index];
+      }
+    }
+    exportContingenciesCosts(expected, measured, history);
+    updateContingenciesHistory(measured);
+  }
+
+  if (config_.isArchiveSAOutputsOn() && mpiContext.isRootProc()) {
+    archiveOutputsContingencies();
+  }
+}
+
+std::deque<std::size_t> Context::reuseContingenciesResults(const std::vector<std::size_t> &order, SecurityAnalysisProgress &progress) {
+  auto &mpiContext = DYNAlgorithms::multiprocessing::context();
+  std::deque<std::size_t> pending;
+  std::size_t nbResumed = 0;
+  for (auto index : order) {
+    bool reused = false;
+    if (mpiContext.isRootProc()) {
+      const std::string &contingencyId = progress.contingencyIds[index];
+      const std::string &fingerprint = helper::fingerprintOf(contingenciesFingerprints_, contingencyId);
+      auto previous = progress.journal->previousEntries().find(contingencyId);
+      outputs::ResultCache::Result cached;
+      if (!fingerprint.empty() && previous != progress.journal->previousEntries().end() && previous->second.fingerprint == fingerprint &&
+          previous->second.status != helper::timeoutStatus && file::is_directory(config_.outputDir() / previous->second.resultDir)) {
+        // already recorded in the journal
+        progress.statuses[index] = previous->second.status;
+        progress.durations[index] = previous->second.wallTime;
+        progress.solverProfiles[index] = previous->second.solverProfile;
+        ++nbResumed;
+        reused = true;
+      } else if (progress.resultCache && !fingerprint.empty()) {
+        try {
+          reused = progress.resultCache->restore(fingerprint, config_.outputDir() / contingencyId, cached);
+        } catch (const std::exception &e) {
+          LOG(warn, ResultCacheFailed, e.what());
+        }
+        if (reused) {
+          progress.statuses[index] = cached.status;
+          progress.durations[index] = cached.wallTime;
+          progress.solverProfiles[index] = cached.solverProfile;
+          ++resultCacheHits_;
+          completeContingency(index, progress);
+        } else {
+          ++resultCacheMisses_;
+        }
+      }
+    }
+    // all the processes must give the same scenarios to dynawo-algorithms
+    mpiContext.broadcast(reused);
+    if (!reused) {
+      pending.push_back(index);
+    }
+  }
+  if (mpiContext.isRootProc()) {
+    if (def_.resume) {
+      LOG(info, SAResumed, nbResumed, order.size());
+    }
+    if (progress.resultCache) {
+      LOG(info, ResultCacheStats, resultCacheHits_, resultCacheMisses_);
+    }
+  }
+  return pending;
+}
+
+bool Context::retryContingency(std::size_t index, SecurityAnalysisProgress &progress) const {
+  // Diverging or timed out contingencies are simulated again with the next solver profile, until one succeeds or none is left
+  const std::string &status = progress.statuses[index];
+  if ((status != helper::timeoutStatus && status != helper::toString(DYNAlgorithms::DIVERGENCE_STATUS)) ||
+      progress.solverProfiles[index] >= config_.getSolverProfiles().size()) {
+    return false;
+  }
+  ++progress.solverProfiles[index];
+  LOG(info, SolverProfileRetry, progress.contingencyIds[index], progress.solverProfiles[index]);
+  return true;
+}
+
+void Context::completeContingency(std::size_t index, SecurityAnalysisProgress &progress) const {
+  const std::string &contingencyId = progress.contingencyIds[index];
+  const std::string &fingerprint = helper::fingerprintOf(contingenciesFingerprints_, contingencyId);
+  const std::string &status = progress.statuses[index];
+  if (progress.solverProfiles[index] > 0 && status == helper::toString(DYNAlgorithms::CONVERGENCE_STATUS)) {
+    LOG(info, SolverProfileSucceeded, contingencyId, progress.solverProfiles[index]);
+  }
+  progress.journal->append({contingencyId, fingerprint, status, progress.durations[index], contingencyId, progress.solverProfiles[index]});
+  // an execution problem, such as a timeout, may not happen again with the same inputs
+  if (progress.resultCache && !fingerprint.empty() && status != helper::toString(DYNAlgorithms::EXECUTION_PROBLEM_STATUS) &&
+      status != helper::timeoutStatus) {
+    try {
+      progress.resultCache->store(fingerprint, config_.outputDir() / contingencyId, {status, progress.durations[index], progress.solverProfiles[index]});
+    } catch (const std::exception &e) {
+      LOG(warn, ResultCacheFailed, e.what());
+    }
+  }
+}
+
+void Context::executeSecurityAnalysisInProcess(unsigned int nbProcesses, std::deque<std::size_t> pending, SecurityAnalysisProgress &progress) {
+  std::vector<boost::shared_ptr<job::JobEntry>> jobs;
+  for (const auto &contingencyId : progress.contingencyIds) {
+    // Same job as the one given to dynawo-algorithms, completed with the events of the contingency
+    outputs::Job jobWriter(outputs::Job::JobDefinition(basename_, def_.dynawoLogLevel, config_));
+    auto job = jobWriter.write();
+    auto modelsEvent = job::DynModelsEntryFactory::newInstance();
+    modelsEvent->setDydFile(basename_ + "-" + contingencyId + ".dyd");
+    job->getModelerEntry()->addDynModelsEntry(modelsEvent);
+    jobs.push_back(job);
+  }
+
+  const std::string &inputDirectory = file::canonical(config_.outputDir()).generic_string();
+#ifndef _WIN32
+  LOG(info, SecurityAnalysisProcesses, pending.size(), nbProcesses);
+  // Dynawo keeps process-wide state which is not thread-safe, such as the trace appenders set up and reset by each simulation, the timers and the
+  // loaded model libraries: each contingency is therefore simulated in its own process
+  // Each forked process simulates its contingency on its own copy of the network already loaded by the launcher, but builds and initializes
+  // its own model: the events of the contingency are dynamic models of its DYD file, which cannot be added to a model already initialized
+  auto dataInterface = networkManager_.dataInterface();
+  std::map<pid_t, std::pair<std::size_t, int>> running;  // index of the contingency and read end of the status pipe, by process
+  std::vector<std::chrono::steady_clock::time_point> starts(progress.contingencyIds.size());
+  while (!pending.empty() || !running.empty()) {
+    while (!pending.empty() && running.size() < nbProcesses) {
+      const std::size_t index = pending.front();
+      pending.pop_front();
+      jobs[index]->getSolverEntry()->setParametersId(outputs::Solver::setId(progress.solverProfiles[index]));
+      int fds[2];
+      if (pipe(fds) != 0) {
+        throw Error(SAForkError, progress.contingencyIds[index], strerror(errno));
+      }
+      starts[index] = std::chrono::steady_clock::now();
+      pid_t pid = fork();
+      if (pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        throw Error(SAForkError, progress.contingencyIds[index], strerror(errno));
+      }
+      if (pid == 0) {
+        close(fds[0]);
+        if (config_.getScenarioTimeout() > 0.) {
+          // the process is killed by the alarm signal once its wall-clock budget is spent
+          alarm(static_cast<unsigned int>(std::ceil(config_.getScenarioTimeout())));
+        }
+        int status = DYNAlgorithms::EXECUTION_PROBLEM_STATUS;
+        try {
+          status = simulateContingency(progress.contingencyIds[index], jobs[index], dataInterface, inputDirectory).getStatus();
+        } catch (...) {
+          // reported as an execution problem
+        }
+        ssize_t written = write(fds[1], &status, sizeof(status));
+        close(fds[1]);
+        // the process must not run the exit handlers and destructors of the launcher
+        _exit(written == sizeof(status) ? EXIT_SUCCESS : EXIT_FAILURE);
+      }
+      close(fds[1]);
+      running[pid] = std::make_pair(index, fds[0]);
+    }
+
+    // The status pipe of a process becomes readable once it has reported its status or died, so that only the processes
+    // forked here are waited for
+    std::vector<pollfd> pipes;
+    for (const auto &process : running) {
+      pollfd statusPipe = {process.second.second, POLLIN, 0};
+      pipes.push_back(statusPipe);
+    }
+    if (poll(pipes.data(), pipes.size(), -1) < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw Error(SAForkError, progress.contingencyIds[running.begin()->second.first], strerror(errno));
+    }
+    auto ready = std::find_if(pipes.begin(), pipes.end(), [](const pollfd &statusPipe) { return statusPipe.revents != 0; });
+    auto found = std::find_if(running.begin(), running.end(),
+                              [&ready](const std::pair<const pid_t, std::pair<std::size_t, int>> &process) { return process.second.second == ready->fd; });
+    const std::size_t index = found->second.first;
+    int status = DYNAlgorithms::EXECUTION_PROBLEM_STATUS;
+    if (read(found->second.second, &status, sizeof(status)) != sizeof(status)) {
+      // the process crashed before reporting its status
+      status = DYNAlgorithms::EXECUTION_PROBLEM_STATUS;
+    }
+    close(found->second.second);
+    int processStatus = 0;
+    while (waitpid(found->first, &processStatus, 0) < 0 && errno == EINTR) {
+    }
+    // the durations of all the attempts of a contingency are summed
+    progress.durations[index] =
+        std::max(progress.durations[index], 0.) + std::chrono::duration<double>(std::chrono::steady_clock::now() - starts[index]).count();
+    const bool timedOut = WIFSIGNALED(processStatus) && WTERMSIG(processStatus) == SIGALRM;
+    progress.statuses[index] = timedOut ? helper::timeoutStatus : helper::toString(static_cast<DYNAlgorithms::status_t>(status));
+    running.erase(found);
+    if (retryContingency(index, progress)) {
+      // the contingency is known to be long: it is simulated again before the remaining ones
+      pending.push_front(index);
+    } else {
+      completeContingency(index, progress);
+    }
+  }
+#else
+  // processes cannot be forked, the executor is never used
+  (void)nbProcesses;
+  (void)pending;
+  (void)inputDirectory;
+#endif
+}
+
+void Context::executeSecurityAnalysisWithLauncher(std::deque<std::size_t> pending, SecurityAnalysisProgress &progress) {
+  auto &mpiContext = DYNAlgorithms::multiprocessing::context();
+  file::path aggregatedResults(config_.outputDir());
+  aggregatedResults.append("aggregatedResults.xml");
+  // Each pass simulates the contingencies left with the next solver profile, set in the jobs file shared by all the scenarios
+  unsigned int solverProfile = 0;
+  for (; !pending.empty(); ++solverProfile) {
+    if (mpiContext.isRootProc()) {
+      if (solverProfile > 0) {
+        jobEntry_->getSolverEntry()->setParametersId(outputs::Solver::setId(solverProfile));
+        outputs::Job::exportJob(jobEntry_, absolute(def_.networkFilepath), config_);
+      }
+      for (auto index : pending) {
+        restoreCompiledModels(config_.outputDir() / progress.contingencyIds[index]);
+      }
+    }
+    // the files written by the root process are read by all the processes
+    DYNAlgorithms::multiprocessing::Context::sync();
+
+    // Create one scenario for each contingency left to simulate
+    auto scenarios = boost::make_shared<DYNAlgorithms::Scenarios>();
+    scenarios->setJobsFile(jobEntry_->getName() + ".jobs");
+    for (auto index : pending) {
       auto scenario = boost::make_shared<DYNAlgorithms::Scenario>();
-      scenario->setId(contingencyRef.id);
-      scenario->setDydFile(basename_ + "-" + contingencyRef.id + ".dyd");
+      scenario->setId(progress.contingencyIds[index]);
+      scenario->setDydFile(basename_ + "-" + progress.contingencyIds[index] + ".dyd");
       scenarios->addScenario(scenario);
-      LOG(info, ContingencySimulationDefined, contingencyRef.id);
-    }
-  }
-  // Use dynawo-algorithms Systematic Analysis Launcher to simulate all the scenarios
-  auto multipleJobs = multipleJobs::MultipleJobsFactory::newInstance();
-  multipleJobs->setScenarios(scenarios);
-  auto saLauncher = boost::make_shared<DYNAlgorithms::SystematicAnalysisLauncher>();
-  saLauncher->setMultipleJobs(multipleJobs);
-  saLauncher->setOutputFile("aggregatedResults.xml");
-  saLauncher->setDirectory(config_.outputDir().generic_string());
-  saLauncher->init();
-  saLauncher->launch();
-  saLauncher->writeResults();
+    }
+    auto multipleJobs = multipleJobs::MultipleJobsFactory::newInstance();
+    multipleJobs->setScenarios(scenarios);
+    auto saLauncher = boost::make_shared<DYNAlgorithms::SystematicAnalysisLauncher>();
+    saLauncher->setMultipleJobs(multipleJobs);
+    saLauncher->setOutputFile(aggregatedResults.filename().generic_string());
+    saLauncher->setDirectory(config_.outputDir().generic_string());
+    saLauncher->init();
+    saLauncher->launch();
+    saLauncher->writeResults();
+
+    if (mpiContext.isRootProc()) {
+      std::map<std::string, boost::property_tree::ptree> scenarioResults;
+      try {
+        scenarioResults = helper::readScenarioResults(aggregatedResults);
+      } catch (const boost::property_tree::ptree_error &e) {
+        // the scenarios of the pass are reported as execution problems
+        LOG(warn, SAResultsUnreadable, aggregatedResults.generic_string(), e.what());
+      }
+      for (auto index : pending) {
+        storeCompiledModels(config_.outputDir() / progress.contingencyIds[index]);
+        auto found = scenarioResults.find(progress.contingencyIds[index]);
+        if (found != scenarioResults.end()) {
+          progress.launcherResults[index] = found->second;
+          progress.statuses[index] = found->second.get("<xmlattr>.status", helper::toString(DYNAlgorithms::EXECUTION_PROBLEM_STATUS));
+        } else {
+          progress.launcherResults[index].clear();
+          progress.statuses[index] = helper::toString(DYNAlgorithms::EXECUTION_PROBLEM_STATUS);
+        }
+      }
+    }
+    std::deque<std::size_t> retried;
+    for (auto index : pending) {
+      bool retry = mpiContext.isRootProc() && retryContingency(index, progress);
+      // all the processes must give the same scenarios to dynawo-algorithms
+      mpiContext.broadcast(retry);
+      if (retry) {
+        retried.push_back(index);
+      } else if (mpiContext.isRootProc()) {
+        completeContingency(index, progress);
+      }
+    }
+    pending.swap(retried);
+  }
+
+  if (solverProfile > 1 && mpiContext.isRootProc()) {
+    // the exported jobs file is left with the default solver parameters
+    jobEntry_->getSolverEntry()->setParametersId(outputs::Solver::setId(0));
+    outputs::Job::exportJob(jobEntry_, absolute(def_.networkFilepath), config_);
+  }
+}
+
+void Context::exportAggregatedResults(const SecurityAnalysisProgress &progress) const {
+  // Statuses which are not statuses of dynawo-algorithms, such as timeouts, are exported as execution problems and then updated
+  std::vector<DYNAlgorithms::SimulationResult> results(progress.contingencyIds.size());
+  std::map<std::string, std::size_t> indexes;
+  for (std::size_t index = 0; index < progress.contingencyIds.size(); ++index) {
+    DYNAlgorithms::status_t status = DYNAlgorithms::EXECUTION_PROBLEM_STATUS;
+    helper::fromString(progress.statuses[index], status);
+    results[index].setScenarioId(progress.contingencyIds[index]);
+    results[index].setStatus(status);
+    results[index].setSuccess(status == DYNAlgorithms::CONVERGENCE_STATUS);
+    indexes[progress.contingencyIds[index]] = index;
+  }
+  file::path aggregatedResults(config_.outputDir());
+  aggregatedResults.append("aggregatedResults.xml");
+  aggregatedResults::XmlExporter exporter;
+  exporter.exportScenarioResultsToFile(results, aggregatedResults.generic_string());
+
+  boost::property_tree::ptree resultsTree;
+  boost::property_tree::read_xml(aggregatedResults.generic_string(), resultsTree, boost::property_tree::xml_parser::trim_whitespace);
+  for (auto &root : resultsTree) {
+    for (auto &scenario : root.second) {
+      const std::string &tag = scenario.first;
+      auto id = scenario.second.get_optional<std::string>("<xmlattr>.id");
+      auto found = id ? indexes.find(*id) : indexes.end();
+      if (tag.substr(tag.find(':') + 1) != "scenarioResults" || found == indexes.end()) {
+        continue;
+      }
+      if (!progress.launcherResults[found->second].empty()) {
+        // the results written by dynawo-algorithms hold the details of the failed criteria
+        scenario.second = progress.launcherResults[found->second];
+      } else if (!progress.statuses[found->second].empty()) {
+        scenario.second.put("<xmlattr>.status", progress.statuses[found->second]);
+      }
+    }
+  }
+  boost::property_tree::write_xml(aggregatedResults.generic_string(), resultsTree, std::locale(),
+                                  boost::property_tree::xml_writer_make_settings<std::string>(' ', 2));
+}
+
+algo::ContingencyCosts::Costs Context::readContingenciesDurations() const {
+  algo::ContingencyCosts::Costs durations;
+  file::path historyPath(config_.historyDir());
+  historyPath.append(outputs::constants::contingenciesHistoryFileName);
+  if (file::exists(historyPath)) {
+    try {
+      // the last duration measured for each contingency, records being read in the order of the runs
+      for (const auto &record : outputs::ContingenciesHistory(historyPath).read()) {
+        if (record.wallTime >= 0.) {
+          durations[record.contingencyId] = record.wallTime;
+        }
+      }
+      return durations;
+    } catch (const std::exception &e) {
+      durations.clear();
+      LOG(warn, ContingenciesHistoryUnreadable, historyPath.generic_string(), e.what());
+    }
+  }
+
+  // without history, the durations exported by the previous run in the output directory are used
+  file::path costsPath(config_.outputDir());
+  costsPath.append(outputs::constants::contingenciesCostsFileName);
+  if (file::exists(costsPath)) {
+    try {
+      boost::property_tree::ptree costsTree;
+      boost::property_tree::read_json(costsPath.generic_string(), costsTree);
+      for (const auto &contingency : costsTree.get_child("contingencies")) {
+        auto measured = contingency.second.get_optional<double>("measured");
+        if (measured) {
+          durations[contingency.second.get<std::string>("id")] = *measured;
+        }
+      }
+    } catch (const boost::property_tree::ptree_error &) {
+      durations.clear();
+      LOG(warn, ContingenciesCostsUnreadable, costsPath.generic_string());
+    }
+  }
+  return durations;
+}
+
+void Context::exportContingenciesCosts(const algo::ContingencyCosts::Costs &expected, const algo::ContingencyCosts::Costs &measured,
+                                       const algo::ContingencyCosts::Costs &history) const {
+  if (measured.empty()) {
+    // nothing was learnt by this run: the file of a previous run is kept as is
+    return;
+  }
+  boost::property_tree::ptree costsTree;
+  boost::property_tree::ptree contingenciesTree;
+  if (validContingencies_) {
+    for (const auto &contingency : validContingencies_->get()) {
+      boost::property_tree::ptree contingencyTree;
+      contingencyTree.put("id", contingency.id);
+      contingencyTree.put("expected", expected.at(contingency.id));
+      auto found = measured.find(contingency.id);
+      if (found != measured.end()) {
+        contingencyTree.put("measured", found->second);
+      } else {
+        auto previous = history.find(contingency.id);
+        if (previous != history.end()) {
+          contingencyTree.put("measured", previous->second);
+        }
+      }
+      contingenciesTree.push_back(std::make_pair("", contingencyTree));
+    }
+  }
+  costsTree.add_child("contingencies", contingenciesTree);
+
+  file::path costsPath(config_.outputDir());
+  costsPath.append(outputs::constants::contingenciesCostsFileName);
+  std::ofstream ofs(costsPath.c_str(), std::ios::binary);
+  boost::property_tree::json_parser::write_json(ofs, costsTree);
+}
+
+DYNAlgorithms::SimulationResult Context::simulateContingency(const std::string &contingencyId, const boost::shared_ptr<job::JobEntry> &job,
+                                                             const boost::shared_ptr<DYN::DataInterface> &dataInterface,
+                                                             const std::string &inputDirectory) const {
+  DYNAlgorithms::SimulationResult result;
+  result.setScenarioId(contingencyId);
+
+  // Same working directory as the one used by dynawo-algorithms for the scenario
+  file::path workingDirectory(config_.outputDir());
+  workingDirectory.append(contingencyId);
+  file::create_directories(workingDirectory);
+  auto simu_context = boost::make_shared<DYN::SimulationContext>();
+  simu_context->setResourcesDirectory(def_.dynawoResDir.generic_string());
+  simu_context->setLocale(def_.locale);
+  simu_context->setInputDirectory(inputDirectory);
+  simu_context->setWorkingDirectory(workingDirectory.generic_string());
+
+  boost::shared_ptr<DYN::Simulation> simu;
+  auto terminate = [&simu]() {
+    if (!simu) {
+      return;
+    }
+    try {
+      simu->terminate();
+    } catch (...) {
+      // the failure of the contingency is already recorded
+    }
+  };
+  restoreCompiledModels(workingDirectory);
+  try {
+    simu = boost::make_shared<DYN::Simulation>(job, simu_context, dataInterface);
+    simu->init();
+    storeCompiledModels(workingDirectory);
+    simu->simulate();
+    simu->terminate();
+    simu->clean();
+    result.setSuccess(true);
+    result.setStatus(DYNAlgorithms::CONVERGENCE_STATUS);
+  } catch (const DYN::Error &e) {
+    terminate();
+    result.setSuccess(false);
+    if (e.type() == DYN::Error::SOLVER_ALGO || e.type() == DYN::Error::SUNDIALS_ERROR) {
+      result.setStatus(DYNAlgorithms::DIVERGENCE_STATUS);
+    } else {
+      result.setStatus(DYNAlgorithms::EXECUTION_PROBLEM_STATUS);
+    }
+  } catch (const DYN::MessageError &) {
+    terminate();
+    result.setSuccess(false);
+    result.setStatus(DYNAlgorithms::EXECUTION_PROBLEM_STATUS);
+  } catch (const std::exception &) {
+    terminate();
+    result.setSuccess(false);
+    result.setStatus(DYNAlgorithms::EXECUTION_PROBLEM_STATUS);
+  }
+  return result;
+}
+
+void Context::updateContingenciesHistory(const algo::ContingencyCosts::Costs &measured) const {
+  if (!validContingencies_) {
+    return;
+  }
+  try {
+    // Final status of each scenario, whichever launcher simulated it
+    file::path aggregatedResults(config_.outputDir());
+    aggregatedResults.append("aggregatedResults.xml");
+    const auto &scenarioResults = helper::readScenarioResults(aggregatedResults);
+
+    const int64_t timestamp = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    std::vector<outputs::ContingenciesHistory::Record> records;
+    for (const auto &contingency : validContingencies_->get()) {
+      outputs::ContingenciesHistory::Record record;
+      record.timestamp = timestamp;
+      record.contingencyId = contingency.id;
+      record.fingerprint = helper::fingerprintOf(contingenciesFingerprints_, contingency.id);
+      auto scenarioResult = scenarioResults.find(contingency.id);
+      record.status = (scenarioResult != scenarioResults.end()) ? scenarioResult->second.get("<xmlattr>.status", "UNKNOWN") : "UNKNOWN";
+      auto wallTime = measured.find(contingency.id);
+      record.wallTime = (wallTime != measured.end()) ? wallTime->second : -1.;
+      records.push_back(record);
+    }
+
+    file::path historyPath(config_.historyDir());
+    historyPath.append(outputs::constants::contingenciesHistoryFileName);
+    outputs::ContingenciesHistory(historyPath).append(records);
+  } catch (const std::exception &e) {
+    // the simulation results are complete: the history only misses this run
+    LOG(warn, SAHistoryFailed, e.what());
+  }
+}
+
+void Context::archiveOutputsContingencies() {
+  std::vector<std::string> contingencyIds;
+  if (validContingencies_) {
+    for (const auto &contingency : validContingencies_->get()) {
+      contingencyIds.push_back(contingency.id);
+    }
+  }
+  outputs::ContingenciesArchive archiveWriter(
+      outputs::ContingenciesArchive::ContingenciesArchiveDefinition(basename_, config_.outputDir(), contingencyIds, config_.isRemoveArchivedSAOutputsOn()));
+  try {
+    archiveWriter.write();
+    LOG(info, SAArchiveDone, contingencyIds.size(), outputs::constants::contingenciesArchiveFileName);
+  } catch (const std::exception &e) {
+    // the simulation results are complete: a packing failure only keeps the files as they are
+    LOG(warn, SAArchiveFailed, e.what());
+  }
 }
 
 void Context::exportResults(bool simulationOk) {
@@ -378,6 +1207,20 @@ void Context::exportResults(bool simulationOk) {
   componentResultsChild.put("slackBusActivePowerMismatch", 0);
   componentResultsTree.push_back(std::make_pair("", componentResultsChild));
   resultsTree.add_child("componentResults", componentResultsTree);
+  if (isResultCacheUsed_) {
+    resultsTree.put("resultCache.hits", resultCacheHits_);
+    resultsTree.put("resultCache.misses", resultCacheMisses_);
+  }
+  if (!contingenciesSolverProfiles_.empty()) {
+    boost::property_tree::ptree solverProfilesTree;
+    for (const auto &solverProfile : contingenciesSolverProfiles_) {
+      boost::property_tree::ptree solverProfileChild;
+      solverProfileChild.put("id", solverProfile.first);
+      solverProfileChild.put("solverProfile", solverProfile.second);
+      solverProfilesTree.push_back(std::make_pair("", solverProfileChild));
+    }
+    resultsTree.add_child("solverProfiles", solverProfilesTree);
+  }
 
   file::path resultsOutput(config_.outputDir());
   std::string fileName = "results.json";
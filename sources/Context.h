@@ -18,8 +18,10 @@
 #pragma once
 
 #include "AlgorithmsResults.h"
+#include "CompilationCache.h"
 #include "Configuration.h"
 #include "ContingenciesManager.h"
+#include "ContingencyCostAlgorithm.h"
 #include "ContingencyValidationAlgorithm.h"
 #include "DynModelDefinitionAlgorithm.h"
 #include "DynamicDataBaseManager.h"
@@ -28,14 +30,23 @@
 #include "LineDefinitionAlgorithm.h"
 #include "LoadDefinitionAlgorithm.h"
 #include "MainConnexComponentAlgorithm.h"
+#include "Manifest.h"
 #include "NetworkManager.h"
+#include "ProgressJournal.h"
+#include "ResultCache.h"
 #include "SVarCDefinitionAlgorithm.h"
 #include "ShuntDefinitionAlgorithm.h"
 #include "SlackNodeAlgorithm.h"
 #include "TransfoDefinitionAlgorithm.h"
 
+#include <DYNSimulationResult.h>
 #include <JOBJobEntry.h>
 #include <boost/filesystem.hpp>
+#include <boost/optional.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <deque>
+#include <map>
+#include <memory>
 
 namespace dfl {
 /**
@@ -66,6 +77,7 @@ class Context {
     std::string dynawoLogLevel;                                       ///< string representation of the dynawo log level
     boost::filesystem::path dynawoResDir;                             ///< DYNAWO resources
     std::string locale;                                               ///< localization
+    bool resume;                                                      ///< resume an interrupted security analysis
   };
 
  public:
@@ -142,7 +154,45 @@ class Context {
     ALGORITHM  ///< Slack node is computed via automatic algorithm
   };
 
+  /// @brief Inputs of the context, loaded concurrently as they do not depend on each other
+  struct LoadedInputs {
+    boost::optional<inputs::NetworkManager> networkManager;                  ///< network manager
+    boost::optional<inputs::DynamicDataBaseManager> dynamicDataBaseManager;  ///< dynamic model configuration manager
+    boost::optional<inputs::ContingenciesManager> contingenciesManager;      ///< contingencies manager
+  };
+
+  /// @brief Progress of the simulations of the valid contingencies of a security analysis, indexed as the valid contingencies
+  struct SecurityAnalysisProgress {
+    std::vector<std::string> contingencyIds;                   ///< id of each contingency
+    std::vector<std::string> statuses;                         ///< status of the last simulation of each contingency, as written in the results
+    std::vector<double> durations;                             ///< wall time of the simulations of each contingency in seconds, negative if unknown
+    std::vector<unsigned int> solverProfiles;                  ///< index of the solver profile of the last simulation of each contingency
+    std::vector<boost::property_tree::ptree> launcherResults;  ///< results written by dynawo-algorithms for each contingency, empty otherwise
+    std::unique_ptr<outputs::ProgressJournal> journal;         ///< journal of the simulated contingencies, only held by the root process
+    std::unique_ptr<outputs::ResultCache> resultCache;         ///< cache of the contingencies results, only held by the root process if configured
+  };
+
  private:
+  /**
+   * @brief Constructor from the loaded inputs
+   *
+   * @param def The context definition
+   * @param config configuration to use
+   * @param loadedInputs the inputs of the context
+   */
+  Context(const ContextDef &def, inputs::Configuration &config, LoadedInputs &&loadedInputs);
+
+  /**
+   * @brief Load the network, the dynamic database and the contingencies on concurrent threads
+   *
+   * Once all the inputs are loaded, the error of the network is rethrown first, then the error of the dynamic database and then the
+   * error of the contingencies, whichever thread failed first
+   *
+   * @param def The context definition
+   * @returns the loaded inputs
+   */
+  static LoadedInputs loadInputs(const ContextDef &def);
+
   /**
    * @brief Check connexity
    *
@@ -167,16 +217,145 @@ class Context {
   /// @brief Execute security analysis by running simulations for the base case and all the valid contingencies
   void executeSecurityAnalysis();
 
+  /**
+   * @brief Reuse the results of the contingencies already simulated with the same inputs
+   *
+   * The results are reused from the progress journal of an interrupted run when resuming, and otherwise from the results cache. The root
+   * process decides for each contingency and broadcasts its decision, so that all the processes simulate the same contingencies.
+   *
+   * @param order the indexes of the valid contingencies, in the order in which their simulations are started
+   * @param progress the progress of the security analysis, updated with the reused results
+   * @returns the indexes of the contingencies left to simulate, in the order in which their simulations are started
+   */
+  std::deque<std::size_t> reuseContingenciesResults(const std::vector<std::size_t> &order, SecurityAnalysisProgress &progress);
+
+  /**
+   * @brief Select the next solver profile of a contingency whose simulation diverged or timed out
+   *
+   * @param index the index of the contingency
+   * @param progress the progress of the security analysis, updated with the next solver profile
+   * @returns true if the contingency is to be simulated again, false if it succeeded or no solver profile is left
+   */
+  bool retryContingency(std::size_t index, SecurityAnalysisProgress &progress) const;
+
+  /**
+   * @brief Record the final result of a contingency in the progress journal and in the results cache
+   *
+   * @param index the index of the contingency
+   * @param progress the progress of the security analysis
+   */
+  void completeContingency(std::size_t index, SecurityAnalysisProgress &progress) const;
+
+  /**
+   * @brief Execute security analysis by simulating each valid contingency in a process forked from the launcher
+   *
+   * @param nbProcesses the number of processes simulating the contingencies at the same time
+   * @param pending the indexes of the contingencies to simulate, in the order in which their simulations are started
+   * @param progress the progress of the security analysis, updated with the results and the measured durations
+   */
+  void executeSecurityAnalysisInProcess(unsigned int nbProcesses, std::deque<std::size_t> pending, SecurityAnalysisProgress &progress);
+
+  /**
+   * @brief Execute security analysis by simulating the valid contingencies with dynawo-algorithms, on all the MPI processes
+   *
+   * Contingencies to simulate again are simulated by a new pass of dynawo-algorithms, with the next solver profile set in the jobs file
+   *
+   * @param pending the indexes of the contingencies to simulate, in the order in which their simulations are started
+   * @param progress the progress of the security analysis, updated with the results on the root process
+   */
+  void executeSecurityAnalysisWithLauncher(std::deque<std::size_t> pending, SecurityAnalysisProgress &progress);
+
+  /**
+   * @brief Export the final results of all the valid contingencies in the aggregated results file
+   *
+   * The results written by dynawo-algorithms are kept as is, the other ones are exported with their status
+   *
+   * @param progress the progress of the security analysis
+   */
+  void exportAggregatedResults(const SecurityAnalysisProgress &progress) const;
+
+  /**
+   * @brief Read the durations of the contingencies simulations measured by previous runs
+   *
+   * The last duration recorded in the contingencies history is used for each contingency. Without history, the durations
+   * exported in the output directory by the previous run are used.
+   *
+   * @returns the measured duration of each contingency, in seconds
+   */
+  algo::ContingencyCosts::Costs readContingenciesDurations() const;
+
+  /**
+   * @brief Export the expected and measured durations of the contingencies simulations
+   *
+   * Durations measured by previous runs are kept for the contingencies whose simulation was not timed by this run. Nothing is
+   * exported when no simulation was timed by this run.
+   *
+   * @param expected the expected duration of each contingency
+   * @param measured the measured duration of each contingency
+   * @param history the durations measured by previous runs
+   */
+  void exportContingenciesCosts(const algo::ContingencyCosts::Costs &expected, const algo::ContingencyCosts::Costs &measured,
+                                const algo::ContingencyCosts::Costs &history) const;
+
+  /**
+   * @brief Simulate a contingency in the launcher process
+   *
+   * @param contingencyId the id of the contingency
+   * @param job the job of the contingency
+   * @param dataInterface the data interface of the network, updated by the simulation
+   * @param inputDirectory the directory containing the input files of the simulation
+   * @returns the result of the simulation
+   */
+  DYNAlgorithms::SimulationResult simulateContingency(const std::string &contingencyId, const boost::shared_ptr<job::JobEntry> &job,
+                                                      const boost::shared_ptr<DYN::DataInterface> &dataInterface, const std::string &inputDirectory) const;
+
+  /**
+   * @brief Open the cache of the compiled dynamic models, if a cache directory is configured
+   *
+   * The cache key depends on the modelica models and model templates of the exported DYD file, which are the models compiled by the
+   * simulations, and on the version of Dynawo
+   */
+  void openCompilationCache();
+
+  /**
+   * @brief Copy the cached compiled dynamic models in the compilation directory of a simulation
+   *
+   * @param workingDirectory the working directory of the simulation
+   */
+  void restoreCompiledModels(const boost::filesystem::path &workingDirectory) const;
+
+  /**
+   * @brief Add the dynamic models compiled by a simulation to the cache
+   *
+   * @param workingDirectory the working directory of the simulation
+   */
+  void storeCompiledModels(const boost::filesystem::path &workingDirectory) const;
+
+  /**
+   * @brief Append the outcome of the simulation of each valid contingency to the contingencies history
+   *
+   * @param measured the measured duration of each contingency
+   */
+  void updateContingenciesHistory(const algo::ContingencyCosts::Costs &measured) const;
+
+  /// @brief Pack the files of each contingency in an archive once the security analysis is done
+  void archiveOutputsContingencies();
+
   /// @brief Prepare the job file
   void exportOutputJob();
 
   /// @brief Prepare the output files required to simulate the valid contingencies
-  void exportOutputsContingencies();
+  /// @param manifest the manifest of the output directory
+  /// @param inputsFingerprint the fingerprint of the inputs shared by all the contingencies
+  void exportOutputsContingencies(outputs::Manifest &manifest, const std::string &inputsFingerprint);
 
   /// @brief Prepare the output files required to simulate a given contingency
   /// @param contingency the contingency
   /// @param elementsNetworkType ids of network elements with a network type
-  void exportOutputsContingency(const inputs::Contingency &contingency, const std::unordered_set<std::string> &elementsNetworkType);
+  /// @param manifest the manifest of the output directory
+  /// @param inputsFingerprint the fingerprint of the inputs shared by all the contingencies
+  void exportOutputsContingency(const inputs::Contingency &contingency, const std::unordered_set<std::string> &elementsNetworkType,
+                                outputs::Manifest &manifest, const std::string &inputsFingerprint);
 
  private:
   ContextDef def_;                                         ///< context definition
@@ -200,6 +379,14 @@ class Context {
   algo::LinesByIdDefinitions linesById_;                                     ///< Lines by ids definition
   algo::TransformersByIdDefinitions tfosById_;                               ///< Transformers by ids definition
   boost::optional<algo::ValidContingencies> validContingencies_;             ///< contingencies accepted for simulation in a Security Analyasis
+  algo::ContingencyCosts contingencyCosts_;                                  ///< network features to estimate the cost of the contingencies
+  std::map<std::string, std::string> contingenciesFingerprints_;             ///< fingerprint of the inputs of each contingency, by id
+  bool isResultCacheUsed_ = false;                                           ///< whether the contingencies results cache was used
+  unsigned int resultCacheHits_ = 0;                                         ///< number of contingencies results found in the cache
+  unsigned int resultCacheMisses_ = 0;                                       ///< number of contingencies results not found in the cache
+  std::map<std::string, unsigned int> contingenciesSolverProfiles_;          ///< solver profile of the contingencies retried with a relaxed profile
+  std::unique_ptr<outputs::CompilationCache> compilationCache_;              ///< cache of the compiled dynamic models, null when disabled
+  std::string compilationCacheKey_;                                          ///< fingerprint of the dynamic models compiled by the simulations
   std::shared_ptr<algo::AlgorithmsResults> algoResults_;                     ///< reference to algorithms results class
 
   boost::shared_ptr<job::JobEntry> jobEntry_;                 ///< Dynawo job entry
@@ -174,6 +174,14 @@ class AssemblingDataBase {
     std::vector<Device> devices;  ///< list of devices
   };
 
+  /**
+   * @brief Automaton connected to a network element through a single association
+   */
+  struct ElementAutomaton {
+    const DynamicAutomaton *automaton;           ///< automaton connected to the element
+    const SingleAssociation *singleAssociation;  ///< single association containing the element
+  };
+
  private:
   /**
    * @brief Assembling xml document handler
@@ -423,12 +431,24 @@ class AssemblingDataBase {
   };
 
  public:
+  /// @brief Constructor for an empty database
+  AssemblingDataBase() : containsSVC_(false) {}
+
   /**
    * @brief Constructor
    * @param assemblingFilePath the assembling document file path
    */
   explicit AssemblingDataBase(const boost::filesystem::path &assemblingFilePath);
 
+  /// @brief Deleted copy constructor: the indexes point to the elements of the database
+  AssemblingDataBase(const AssemblingDataBase &) = delete;
+  /// @brief Deleted copy assignment operator: the indexes point to the elements of the database
+  AssemblingDataBase &operator=(const AssemblingDataBase &) = delete;
+  /// @brief Move constructor
+  AssemblingDataBase(AssemblingDataBase &&) = default;
+  /// @brief Move assignment operator
+  AssemblingDataBase &operator=(AssemblingDataBase &&) = default;
+
   /**
    * @brief Retrieve a macro connection with its id
    * @param id macro connection id
@@ -512,7 +532,37 @@ class AssemblingDataBase {
    */
   bool isProperty(const std::string &id) const;
 
+  /**
+   * @brief Retrieve the single associations of an automaton
+   * @param automatonId automaton id
+   * @returns the single association of each macro connect of the automaton, in the same order, or nullptr when the macro connect does not use
+   * a single association. Empty list if the automaton is not found
+   */
+  const std::vector<const SingleAssociation *> &getSingleAssociations(const std::string &automatonId) const;
+
+  /**
+   * @brief Retrieve the automatons connected to a network element through its single associations
+   * @param name network element id
+   * @returns the automatons connected to the element, in the order of the automaton ids then of their macro connects, empty list if not found
+   */
+  const std::vector<ElementAutomaton> &getAutomatonsFromElement(const std::string &name) const;
+
+  /**
+   * @brief test if a network element belongs to a property through one of its single associations
+   * @param name network element id
+   * @param propertyId property id
+   * @returns true if a device of the property is a single association containing the element, false otherwise
+   */
+  bool hasProperty(const std::string &name, const std::string &propertyId) const;
+
  private:
+  /**
+   * @brief Build the indexes from the elements of the database, once it is loaded
+   */
+  void buildIndexes();
+
+  friend class DynamicDataBaseBinary;  ///< the binary format reads and writes the database
+
   std::unordered_map<std::string, MacroConnection> macroConnections_;               ///< list of macro connections
   std::unordered_map<std::string, MacroConnection> networkMacroConnections_;        ///< list of macro connections for network components
   std::unordered_map<std::string, SingleAssociation> singleAssociations_;           ///< list of single associations
@@ -522,6 +572,10 @@ class AssemblingDataBase {
   std::map<std::string, DynamicAutomaton> dynamicAutomatons_;                       ///< list of dynamic automatons
   bool containsSVC_;                                      ///< true if the assembling data base contains one or more SVC, false otherwise
   std::unordered_map<std::string, Property> properties_;  ///< list of properties
+  std::unordered_map<std::string, std::vector<const SingleAssociation *>>
+      automatonIdToSingleAssociations_;  ///< single association of each macro connect of the automatons, nullptr for other associations
+  std::unordered_map<std::string, std::vector<ElementAutomaton>> elementIdToAutomatons_;  ///< automatons connected to each network element
+  std::unordered_map<std::string, std::vector<const Property *>> elementIdToProperties_;  ///< properties of each network element
 };
 
 }  // namespace inputs
@@ -19,9 +19,11 @@
 #include <boost/filesystem.hpp>
 #include <boost/optional.hpp>
 #include <boost/property_tree/ptree.hpp>
+#include <map>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace dfl {
 namespace inputs {
@@ -86,6 +88,41 @@ class Configuration {
    */
   bool isAutomaticSlackBusOn() const { return isAutomaticSlackBusOn_; }
 
+  /**
+   * @brief determines if output files whose inputs did not change since the previous run are kept as is
+   *
+   * @returns the parameter value
+   */
+  bool isIncrementalExportOn() const { return isIncrementalExportOn_; }
+
+  /**
+   * @brief determines if the solver parameters are tuned according to the size and the regulations of the network
+   *
+   * @returns the parameter value
+   */
+  bool isSolverAutoTuningOn() const { return isSolverAutoTuningOn_; }
+
+  /**
+   * @brief Retrieves the directory of the cache of the compiled dynamic models, shared by the simulations and the runs
+   *
+   * @returns the directory of the cache, empty when the cache is disabled
+   */
+  const boost::filesystem::path &compilationCacheDir() const { return compilationCacheDir_; }
+
+  /**
+   * @brief Retrieves the maximum size of the cache of the compiled dynamic models
+   *
+   * @returns the maximum size in MB
+   */
+  unsigned int getCompilationCacheMaxSize() const { return compilationCacheMaxSize_; }
+
+  /**
+   * @brief Retrieves the file of the cache of the automaton libraries known to be loadable, shared by the runs
+   *
+   * @returns the file of the cache, empty when the cache is disabled
+   */
+  const boost::filesystem::path &libraryProbeCacheFile() const { return libraryProbeCacheFile_; }
+
   /**
    * @brief Retrieves the output directory
    *
@@ -203,6 +240,86 @@ class Configuration {
    */
   const boost::filesystem::path &startingDumpFilePath() const { return startingDumpFilePath_; }
 
+  /**
+   * @brief determines if the files of each contingency are packed in an archive after the security analysis
+   *
+   * @returns the parameter value
+   */
+  bool isArchiveSAOutputsOn() const { return isArchiveSAOutputsOn_; }
+
+  /**
+   * @brief determines if the files packed in the security analysis archive are removed from the output directory
+   *
+   * @returns the parameter value
+   */
+  bool isRemoveArchivedSAOutputsOn() const { return isRemoveArchivedSAOutputsOn_; }
+
+  /**
+   * @brief Retrieves the number of processes forked by the launcher to simulate the contingencies at the same time
+   *
+   * 0 means that the contingencies are simulated by the dynawo-algorithms systematic analysis launcher
+   *
+   * @returns the parameter value
+   */
+  unsigned int getNbProcesses() const { return nbProcesses_; }
+
+  /**
+   * @brief Retrieves the directory of the contingencies history
+   *
+   * The output directory is used when not set
+   *
+   * @returns the directory of the contingencies history
+   */
+  const boost::filesystem::path &historyDir() const { return historyDir_.empty() ? outputDir_ : historyDir_; }
+
+  /**
+   * @brief Retrieves the directory of the cache of the contingencies simulations results
+   *
+   * Empty means that the results are not cached
+   *
+   * @returns the directory of the results cache
+   */
+  const boost::filesystem::path &resultCacheDir() const { return resultCacheDir_; }
+
+  /**
+   * @brief Retrieves the maximum size of the cache of the contingencies simulations results
+   *
+   * @returns the maximum size in MB
+   */
+  unsigned int getResultCacheMaxSize() const { return resultCacheMaxSize_; }
+
+  /**
+   * @brief Retrieves the wall-clock budget of each contingency simulation
+   *
+   * 0 means that the simulations are not limited
+   *
+   * @returns the budget in seconds
+   */
+  double getScenarioTimeout() const { return scenarioTimeout_; }
+
+  /**
+   * @brief Retrieves the minimum value of the solver timestep of the contingencies simulations
+   *
+   * A simulation which would need a smaller timestep fails instead of going on with tiny steps
+   *
+   * @returns the minimum value of the solver timestep
+   */
+  double getScenarioMinTimeStep() const { return scenarioMinTimeStep_; }
+
+  /**
+   * @brief Solver profile: values of solver parameters overriding the default ones, by parameter name
+   */
+  using SolverProfile = std::map<std::string, double>;
+
+  /**
+   * @brief Retrieves the solver profiles used to simulate again the failed contingencies
+   *
+   * A contingency whose simulation diverged or timed out is simulated again with the next profile, until one succeeds
+   *
+   * @returns the solver profiles, in the order in which they are tried
+   */
+  const std::vector<SolverProfile> &getSolverProfiles() const { return solverProfiles_; }
+
   /**
    * @brief Set the starting dump file path
    * @param startingDumpFilePath the new starting dump file path
@@ -283,6 +400,12 @@ class Configuration {
    * @param saMode true if simulation is in SA, false otherwise
    */
   void updateChosenOutput(const boost::property_tree::ptree &tree, SimulationKind simulationKind, const bool saMode);
+  /**
+   * @brief Helper function to update the solver profiles of the security analysis
+   *
+   * @param tree the element of the boost tree
+   */
+  void updateSolverProfiles(const boost::property_tree::ptree &tree);
 
  private:
   boost::filesystem::path filepath_;                                                 ///< the configuration file path
@@ -294,6 +417,11 @@ class Configuration {
   bool isSVarCRegulationOn_ = true;                                                  ///< StaticVarCompensator regulation on
   bool isShuntRegulationOn_ = true;                                                  ///< Shunt regulation on
   bool isAutomaticSlackBusOn_ = true;                                                ///< automatic slack bus on
+  bool isIncrementalExportOn_ = false;                                               ///< incremental export of output files on
+  bool isSolverAutoTuningOn_ = false;                                                ///< solver parameters tuned according to the network on
+  boost::filesystem::path compilationCacheDir_;                                      ///< directory of the compiled models cache, empty when disabled
+  unsigned int compilationCacheMaxSize_ = 1024;                                      ///< maximum size of the compiled models cache in MB
+  boost::filesystem::path libraryProbeCacheFile_;                                    ///< file of the library probes cache, empty when disabled
   boost::filesystem::path outputDir_ = boost::filesystem::current_path();            ///< Directory for output files
   double dsoVoltageLevel_ = 45.0;                                                    ///< Minimum voltage level of the load to be taken into account
   ActivePowerCompensation activePowerCompensation_ = ActivePowerCompensation::PMAX;  ///< Type of active power compensation
@@ -309,6 +437,15 @@ class Configuration {
   // SA
   double timeOfEvent_ = 10.;                                ///< time for contingency simulation (security analysis only)
   boost::filesystem::path startingDumpFilePath_;            ///< starting dump file path
+  bool isArchiveSAOutputsOn_ = false;                       ///< pack the files of each contingency in an archive
+  bool isRemoveArchivedSAOutputsOn_ = false;                ///< remove the files packed in the archive
+  unsigned int nbProcesses_ = 0;                            ///< number of processes forked to simulate the contingencies
+  boost::filesystem::path historyDir_;                      ///< directory of the contingencies history
+  boost::filesystem::path resultCacheDir_;                  ///< directory of the results cache, empty when disabled
+  unsigned int resultCacheMaxSize_ = 1024;                  ///< maximum size of the results cache in MB
+  double scenarioTimeout_ = 0.;                             ///< wall-clock budget of each contingency simulation in seconds
+  double scenarioMinTimeStep_ = 1.;                         ///< minimum value of the solver timestep of the contingencies simulations
+  std::vector<SolverProfile> solverProfiles_;               ///< solver profiles to simulate again the failed contingencies
                                                             ///< are already described in the static description
   std::unordered_set<std::string> parameterValueModified_;  ///< a parameter key is present in this if the
                                                             ///< value was redefined in the configuration
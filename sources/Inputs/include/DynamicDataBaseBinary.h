@@ -0,0 +1,87 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  DynamicDataBaseBinary.h
+ *
+ * @brief Precompiled binary format of the dynamic database header file
+ *
+ */
+
+#pragma once
+
+#include "AssemblingDataBase.h"
+#include "SettingDataBase.h"
+
+#include <boost/filesystem.hpp>
+
+namespace dfl {
+namespace inputs {
+
+/**
+ * @brief Precompiled binary format of the dynamic database
+ *
+ * A binary file holds the setting and the assembling databases parsed from their XML files, so that they are loaded without parsing
+ * and validating the XML files again. The file starts with a magic number, the version of the format, a byte order mark and, for each
+ * XML file it was compiled from, its canonical absolute path, its size and the fingerprint of its content. The values follow in native
+ * byte order: unsigned 32 bits sizes, strings as their size followed by their characters, booleans and optional values flags on one byte,
+ * integers on 32 bits, file sizes on 64 bits and doubles on 64 bits.
+ * The file is memory mapped when it is read.
+ */
+class DynamicDataBaseBinary {
+ public:
+  /**
+   * @brief Computes the path of the binary file of the dynamic database
+   *
+   * @param settingFilePath the setting document file path
+   * @param assemblingFilePath the assembling document file path
+   * @returns the path of the assembling file, or of the setting file when there is no assembling file, with its stem followed by a hash of
+   * the canonical paths of both files and the ".ddb" extension. Empty if there is neither setting nor assembling file
+   */
+  static boost::filesystem::path binaryPath(const boost::filesystem::path &settingFilePath, const boost::filesystem::path &assemblingFilePath);
+
+  /**
+   * @brief Determines whether a binary file can be used instead of the XML files
+   *
+   * @param binaryFilePath the path of the binary file
+   * @param settingFilePath the setting document file path
+   * @param assemblingFilePath the assembling document file path
+   * @returns true if the binary file was compiled with the current format from the same XML files, with the same sizes and contents
+   */
+  static bool isUpToDate(const boost::filesystem::path &binaryFilePath, const boost::filesystem::path &settingFilePath,
+                         const boost::filesystem::path &assemblingFilePath);
+
+  /**
+   * @brief Export the databases in a binary file
+   *
+   * The file is written under a temporary name renamed once complete, so that a partial file is never read
+   *
+   * @param binaryFilePath the path of the binary file
+   * @param settingFilePath the setting document file path the database was parsed from
+   * @param assemblingFilePath the assembling document file path the database was parsed from
+   * @param setting the setting database
+   * @param assembling the assembling database
+   */
+  static void write(const boost::filesystem::path &binaryFilePath, const boost::filesystem::path &settingFilePath,
+                    const boost::filesystem::path &assemblingFilePath, const SettingDataBase &setting, const AssemblingDataBase &assembling);
+
+  /**
+   * @brief Import the databases from a binary file
+   *
+   * @param binaryFilePath the path of the binary file
+   * @param setting the setting database to fill
+   * @param assembling the assembling database to fill
+   * @returns true if the file was read, false if it is not a valid binary file of the current format, the databases being unchanged
+   */
+  static bool read(const boost::filesystem::path &binaryFilePath, SettingDataBase &setting, AssemblingDataBase &assembling);
+};
+
+}  // namespace inputs
+}  // namespace dfl
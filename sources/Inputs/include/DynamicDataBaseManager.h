@@ -32,6 +32,10 @@ class DynamicDataBaseManager {
  public:
   /**
    * @brief Constructor
+   *
+   * The databases are read from their precompiled binary file when it is newer than the XML files, otherwise the XML files are parsed
+   * on concurrent threads
+   *
    * @param settingFilePath the setting document file path
    * @param assemblingFilePath the assembling document file path
    */
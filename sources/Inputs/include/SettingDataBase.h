@@ -16,8 +16,10 @@
 #pragma once
 
 #include <boost/filesystem.hpp>
+#include <boost/optional.hpp>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <xml/sax/parser/Attributes.h>
 #include <xml/sax/parser/ComposableDocumentHandler.h>
 #include <xml/sax/parser/ComposableElementHandler.h>
@@ -87,14 +89,54 @@ class SettingDataBase {
    * @brief Set XML element
    */
   struct Set {
+    /**
+     * @brief Retrieve the double parameters
+     * @returns the list of the double parameters
+     */
+    const std::vector<Parameter<double>>& doubleParameters() const { return doubleParameters_; }
+
+    /**
+     * @brief Replace the double parameters and build their indexes
+     *
+     * The double parameters can only be changed through this function, so that the indexes always follow them
+     *
+     * @param parameters the list of the double parameters
+     */
+    void setDoubleParameters(std::vector<Parameter<double>>&& parameters);
+
+    /**
+     * @brief Find a double parameter with its name
+     * @param name the parameter name
+     * @returns the first double parameter with this name, nullptr if not found
+     */
+    const Parameter<double>* findDoubleParameter(const std::string& name) const;
+
+    /**
+     * @brief Retrieve the value of an indexed double parameter, named <family><index>_
+     * @param family the name of the parameter before its index, for example secondaryVoltageControl_Qr_
+     * @param index the index of the parameter
+     * @returns the value of the last double parameter with this name, nothing if not found
+     */
+    boost::optional<double> getIndexedDoubleParameter(const std::string& family, unsigned int index) const;
+
     std::string id;                                        ///< id of the set
     std::vector<Count> counts;                             ///< list of the counts
     std::vector<Ref> refs;                                 ///< list of the refs
     std::vector<Reference> references;                     ///< list of the references
-    std::vector<Parameter<double>> doubleParameters;       ///< list of the double parameters
     std::vector<Parameter<bool>> boolParameters;           ///< list of the boolean parameters
     std::vector<Parameter<int>> integerParameters;         ///< list of the integer parameters
     std::vector<Parameter<std::string>> stringParameters;  ///< list of the string parameters
+
+   private:
+    /**
+     * @brief Build the indexes of the double parameters
+     */
+    void buildIndexes();
+
+    std::vector<Parameter<double>> doubleParameters_;                      ///< list of the double parameters
+    std::unordered_map<std::string, std::size_t> doubleParameterIndexes_;  ///< position of the first double parameter of each name
+    std::unordered_map<std::string, std::vector<boost::optional<double>>>
+        indexedDoubleParameters_;  ///< values of the last double parameters named <family><index>_, by family then by index
   };
 
  private:
@@ -180,7 +222,8 @@ class SettingDataBase {
        */
       explicit SetHandler(const elementName_type& root);
 
-      boost::optional<Set> currentSet;  ///< current set element
+      boost::optional<Set> currentSet;                         ///< current set element
+      std::vector<Parameter<double>> currentDoubleParameters;  ///< double parameters of the current set element, given to the set at its end
 
       CountHandler countHandler;          ///< count element handler
       RefHandler refHandler;              ///< ref element handler
@@ -208,6 +251,9 @@ class SettingDataBase {
   };
 
  public:
+  /// @brief Constructor for an empty database
+  SettingDataBase() = default;
+
   /**
    * @brief Constructor
    * @param settingFilePath the setting document file path
@@ -222,6 +268,8 @@ class SettingDataBase {
   const Set& getSet(const std::string& id) const;
 
  private:
+  friend class DynamicDataBaseBinary;  ///< the binary format reads and writes the database
+
   std::unordered_map<std::string, Set> sets_;  ///< list of the sets
 };
 
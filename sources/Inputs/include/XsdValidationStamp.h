@@ -0,0 +1,62 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  XsdValidationStamp.h
+ *
+ * @brief Stamp of a document already validated against its XSD
+ *
+ */
+
+#pragma once
+
+#include <boost/filesystem.hpp>
+
+namespace dfl {
+namespace inputs {
+
+/**
+ * @brief Stamp of a document already validated against its XSD, so that the document is parsed without validation while both are unchanged
+ *
+ * Stamps are empty files of the directory given by the DYNAFLOW_LAUNCHER_XSD_VALIDATION_CACHE environment variable, named after the hashes
+ * of the content of the document and of the XSD. Stamps are not used when the variable is not set, and a document is always validated
+ * when the DYNAFLOW_LAUNCHER_FORCE_XSD_VALIDATION environment variable is "true".
+ */
+class XsdValidationStamp {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param documentPath the path of the document
+   * @param xsdPath the path of the XSD validating the document, empty if the document is not validated
+   */
+  XsdValidationStamp(const boost::filesystem::path& documentPath, const boost::filesystem::path& xsdPath);
+
+  /**
+   * @brief Determines whether the document was already validated against the XSD
+   *
+   * @returns true if the stamp exists and the validation is not forced
+   */
+  bool isValidated() const;
+
+  /**
+   * @brief Records that the document was validated against the XSD
+   *
+   * Failures to write the stamp are ignored, the document being validated again next time
+   */
+  void setValidated() const;
+
+ private:
+  boost::filesystem::path stampPath_;  ///< path of the stamp, empty if stamps are not used
+  bool forced_ = false;                ///< whether the validation is forced
+};
+
+}  // namespace inputs
+}  // namespace dfl
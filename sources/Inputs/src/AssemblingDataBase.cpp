@@ -17,7 +17,9 @@
 
 #include "Constants.h"
 #include "Log.h"
+#include "XsdValidationStamp.h"
 
+#include <algorithm>
 #include <xml/sax/parser/ParserFactory.h>
 
 namespace parser = xml::sax::parser;
@@ -71,9 +73,13 @@ AssemblingDataBase::AssemblingDataBase(const boost::filesystem::path &assembling
   }
 
   auto xsd = computeXsdPath(assemblingFilePath);
+  XsdValidationStamp stamp(assemblingFilePath, xsd);
   if (xsd.empty()) {
     LOG(warn, DynModelFileXSDNotFound, assemblingFilePath.generic_string());
     xsdValidation = false;
+  } else if (stamp.isValidated()) {
+    LOG(debug, DynModelFileValidationSkipped, assemblingFilePath.generic_string());
+    xsdValidation = false;
   } else {
     parser->addXmlSchema(xsd.generic_string());
   }
@@ -83,6 +89,73 @@ AssemblingDataBase::AssemblingDataBase(const boost::filesystem::path &assembling
   } catch (const xml::sax::parser::ParserException &e) {
     throw Error(DynModelFileReadError, assemblingFilePath.generic_string(), e.what());
   }
+  if (xsdValidation) {
+    stamp.setValidated();
+  }
+  buildIndexes();
+}
+
+namespace helper {
+
+/**
+ * @brief Apply a function to the ids of the network elements of a single association
+ * @param singleAssociation the single association
+ * @param function the function to apply to each network element id
+ */
+template<class F>
+static void forEachNetworkElement(const AssemblingDataBase::SingleAssociation &singleAssociation, F function) {
+  for (const auto &generator : singleAssociation.generators) {
+    function(generator.name);
+  }
+  for (const auto &load : singleAssociation.loads) {
+    function(load.name);
+  }
+  if (singleAssociation.tfo)
+    function(singleAssociation.tfo->name);
+  if (singleAssociation.line)
+    function(singleAssociation.line->name);
+  if (singleAssociation.hvdcLine)
+    function(singleAssociation.hvdcLine->name);
+  if (singleAssociation.shunt)
+    function(singleAssociation.shunt->name);
+}
+
+}  // namespace helper
+
+void AssemblingDataBase::buildIndexes() {
+  automatonIdToSingleAssociations_.clear();
+  elementIdToAutomatons_.clear();
+  elementIdToProperties_.clear();
+
+  for (const auto &automaton : dynamicAutomatons_) {
+    auto &singleAssociations = automatonIdToSingleAssociations_[automaton.first];
+    singleAssociations.reserve(automaton.second.macroConnects.size());
+    for (const auto &macroConnect : automaton.second.macroConnects) {
+      const auto it = singleAssociations_.find(macroConnect.id);
+      if (it == singleAssociations_.end()) {
+        singleAssociations.push_back(nullptr);
+        continue;
+      }
+      const SingleAssociation *singleAssociation = &it->second;
+      singleAssociations.push_back(singleAssociation);
+      helper::forEachNetworkElement(*singleAssociation, [this, &automaton, singleAssociation](const std::string &name) {
+        elementIdToAutomatons_[name].push_back(ElementAutomaton{&automaton.second, singleAssociation});
+      });
+    }
+  }
+
+  for (const auto &property : properties_) {
+    for (const auto &device : property.second.devices) {
+      const auto it = singleAssociations_.find(device.id);
+      if (it == singleAssociations_.end())
+        continue;
+      helper::forEachNetworkElement(it->second, [this, &property](const std::string &name) {
+        auto &elementProperties = elementIdToProperties_[name];
+        if (std::find(elementProperties.begin(), elementProperties.end(), &property.second) == elementProperties.end())
+          elementProperties.push_back(&property.second);
+      });
+    }
+  }
 }
 
 const AssemblingDataBase::MacroConnection &AssemblingDataBase::getMacroConnection(const std::string &id, bool network) const {
@@ -142,6 +215,29 @@ const AssemblingDataBase::Property &AssemblingDataBase::getProperty(const std::s
 
 bool AssemblingDataBase::isProperty(const std::string &id) const { return properties_.find(id) != properties_.end(); }
 
+const std::vector<const AssemblingDataBase::SingleAssociation *> &AssemblingDataBase::getSingleAssociations(const std::string &automatonId) const {
+  static const std::vector<const SingleAssociation *> noSingleAssociation;
+  const auto it = automatonIdToSingleAssociations_.find(automatonId);
+  if (it != automatonIdToSingleAssociations_.end())
+    return it->second;
+  return noSingleAssociation;
+}
+
+const std::vector<AssemblingDataBase::ElementAutomaton> &AssemblingDataBase::getAutomatonsFromElement(const std::string &name) const {
+  static const std::vector<ElementAutomaton> noAutomaton;
+  const auto it = elementIdToAutomatons_.find(name);
+  if (it != elementIdToAutomatons_.end())
+    return it->second;
+  return noAutomaton;
+}
+
+bool AssemblingDataBase::hasProperty(const std::string &name, const std::string &propertyId) const {
+  const auto it = elementIdToProperties_.find(name);
+  if (it == elementIdToProperties_.end())
+    return false;
+  return std::any_of(it->second.begin(), it->second.end(), [&propertyId](const Property *property) { return property->id == propertyId; });
+}
+
 /**
  * @return namespace used to read xml file
  */
@@ -203,6 +203,12 @@ Configuration::Configuration(const boost::filesystem::path &filepath, Simulation
     helper::updateValue(isShuntRegulationOn_, config, "ShuntRegulationOn", saMode, parameterValueModified_);
     helper::updateValue(isAutomaticSlackBusOn_, config, "AutomaticSlackBusOn", saMode, parameterValueModified_);
     helper::updatePathValue(outputDir_, config, "OutputDir", prefixConfigFile, false);  // Not possible to override outputDir in SA
+    helper::updateValue(isIncrementalExportOn_, config, "IncrementalExport", false, parameterValueModified_);  // Same outputs for N and SA
+    helper::updateValue(isSolverAutoTuningOn_, config, "SolverAutoTuning", saMode, parameterValueModified_);
+    // Same cache for N and SA, as it is shared by all the simulations
+    helper::updatePathValue(compilationCacheDir_, config, "CompilationCacheDir", prefixConfigFile, false);
+    helper::updateValue(compilationCacheMaxSize_, config, "CompilationCacheMaxSize", false, parameterValueModified_);
+    helper::updatePathValue(libraryProbeCacheFile_, config, "LibraryProbeCacheFile", prefixConfigFile, false);
     helper::updateValue(dsoVoltageLevel_, config, "DsoVoltageLevel", saMode, parameterValueModified_);
     helper::updatePathValue(settingFilePath_, config, "SettingPath", prefixConfigFile, saMode);
     helper::updatePathValue(assemblingFilePath_, config, "AssemblingPath", prefixConfigFile, saMode);
@@ -215,6 +221,15 @@ Configuration::Configuration(const boost::filesystem::path &filepath, Simulation
     if (simulationKind_ == dfl::inputs::Configuration::SimulationKind::SECURITY_ANALYSIS) {
       helper::updateValue(timeOfEvent_, config, "TimeOfEvent", true, parameterValueModified_);
       helper::updatePathValue(startingDumpFilePath_, config, "StartingDumpFile", prefixConfigFile, true);
+      helper::updateValue(isArchiveSAOutputsOn_, config, "ArchiveOutputs", true, parameterValueModified_);
+      helper::updateValue(isRemoveArchivedSAOutputsOn_, config, "RemoveArchivedOutputs", true, parameterValueModified_);
+      helper::updateValue(nbProcesses_, config, "NbProcesses", true, parameterValueModified_);
+      helper::updatePathValue(historyDir_, config, "HistoryDir", prefixConfigFile, true);
+      helper::updatePathValue(resultCacheDir_, config, "ResultCacheDir", prefixConfigFile, true);
+      helper::updateValue(resultCacheMaxSize_, config, "ResultCacheMaxSize", true, parameterValueModified_);
+      helper::updateValue(scenarioTimeout_, config, "ScenarioTimeout", true, parameterValueModified_);
+      helper::updateValue(scenarioMinTimeStep_, config, "ScenarioMinTimeStep", true, parameterValueModified_);
+      updateSolverProfiles(config);
     }
   } catch (std::exception &e) {
     throw Error(ErrorConfigFileRead, e.what());
@@ -264,6 +279,23 @@ void Configuration::updateStartingPointMode(const boost::property_tree::ptree &t
   }
 }
 
+void Configuration::updateSolverProfiles(const boost::property_tree::ptree &tree) {
+  const std::string key = "SolverProfiles";
+  auto optionalSolverProfiles = tree.get_child_optional("sa." + key);
+  if (!optionalSolverProfiles.is_initialized())
+    optionalSolverProfiles = tree.get_child_optional(key);
+  if (!optionalSolverProfiles.is_initialized())
+    return;
+  parameterValueModified_.insert(key);
+  for (const auto &profileTree : *optionalSolverProfiles) {
+    SolverProfile profile;
+    for (const auto &parameter : profileTree.second) {
+      profile[parameter.first] = parameter.second.get_value<double>();
+    }
+    solverProfiles_.push_back(profile);
+  }
+}
+
 void Configuration::updateChosenOutput(const boost::property_tree::ptree &tree,
 #if _DEBUG_
                                        dfl::inputs::Configuration::SimulationKind,
@@ -0,0 +1,753 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  DynamicDataBaseBinary.cpp
+ *
+ * @brief Precompiled binary format of the dynamic database implementation file
+ *
+ */
+
+#include "DynamicDataBaseBinary.h"
+
+#include "Fingerprint.h"
+#include "Log.h"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+namespace file = boost::filesystem;
+
+namespace dfl {
+namespace inputs {
+
+namespace helper {
+
+/// @brief Magic number at the start of a binary file
+static const char magic[8] = {'D', 'F', 'L', '-', 'D', 'D', 'B', '\n'};
+
+/// @brief Version of the format, to increment whenever the layout of the file or of the databases changes
+static const uint32_t formatVersion = 2;
+
+/// @brief Byte order mark, read differently by a platform of another byte order
+static const uint32_t byteOrderMark = 0x01020304;
+
+/// @brief Exception thrown when a binary file does not hold what is expected
+struct MalformedFile {};
+
+/**
+ * @brief Writer of the values of a binary file
+ */
+class Writer {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param os the stream to write into
+   */
+  explicit Writer(std::ostream &os) : os_(os) {}
+
+  /**
+   * @brief Write bytes
+   *
+   * @param data the bytes to write
+   * @param size the number of bytes
+   */
+  void raw(const void *data, std::size_t size) { os_.write(static_cast<const char *>(data), static_cast<std::streamsize>(size)); }
+
+  /**
+   * @brief Write a value with its memory representation
+   *
+   * @param value the value to write
+   */
+  template<class T>
+  void pod(T value) {
+    raw(&value, sizeof(value));
+  }
+
+  /**
+   * @brief Write a size
+   *
+   * @param size the size to write
+   */
+  void size(std::size_t size) { pod(static_cast<uint32_t>(size)); }
+
+ private:
+  std::ostream &os_;  ///< stream to write into
+};
+
+/**
+ * @brief Reader of the values of a memory mapped binary file
+ *
+ * Every read is bounded by the end of the file, so that a truncated file is detected
+ */
+class Reader {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param data the content of the file
+   * @param size the size of the file
+   */
+  Reader(const char *data, std::size_t size) : current_(data), end_(data + size) {}
+
+  /**
+   * @brief Read bytes
+   *
+   * @param data the buffer to fill
+   * @param size the number of bytes to read
+   */
+  void raw(void *data, std::size_t size) { std::memcpy(data, advance(size), size); }
+
+  /**
+   * @brief Read a value from its memory representation
+   *
+   * @returns the value read
+   */
+  template<class T>
+  T pod() {
+    T value;
+    raw(&value, sizeof(value));
+    return value;
+  }
+
+  /**
+   * @brief Read a size
+   *
+   * @param minElementSize the minimum number of bytes of the elements counted by the size
+   * @returns the size read, which cannot exceed the number of remaining elements
+   */
+  std::size_t size(std::size_t minElementSize) {
+    const std::size_t value = pod<uint32_t>();
+    if (value * minElementSize > remaining()) {
+      throw MalformedFile();
+    }
+    return value;
+  }
+
+  /**
+   * @brief Read the characters of a string
+   *
+   * @param str the string to fill
+   */
+  void string(std::string &str) {
+    const std::size_t length = size(1);
+    str.assign(advance(length), length);
+  }
+
+  /**
+   * @brief Determines whether the whole file was read
+   *
+   * @returns true if there are no remaining bytes
+   */
+  bool atEnd() const { return current_ == end_; }
+
+ private:
+  /**
+   * @brief Skip bytes
+   *
+   * @param size the number of bytes to skip
+   * @returns the first skipped byte
+   */
+  const char *advance(std::size_t size) {
+    if (size > remaining()) {
+      throw MalformedFile();
+    }
+    const char *data = current_;
+    current_ += size;
+    return data;
+  }
+
+  /**
+   * @brief Computes the number of remaining bytes
+   *
+   * @returns the number of bytes not read yet
+   */
+  std::size_t remaining() const { return static_cast<std::size_t>(end_ - current_); }
+
+  const char *current_;  ///< next byte to read
+  const char *end_;      ///< end of the file
+};
+
+/**
+ * @brief Memory mapping of a binary file
+ */
+class MappedFile {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param filepath the file to map
+   */
+  explicit MappedFile(const file::path &filepath)
+      : mapping_(filepath.c_str(), boost::interprocess::read_only), region_(mapping_, boost::interprocess::read_only) {}
+
+  /**
+   * @brief Create a reader of the file
+   *
+   * @returns the reader at the start of the file
+   */
+  Reader reader() const { return Reader(static_cast<const char *>(region_.get_address()), region_.get_size()); }
+
+ private:
+  boost::interprocess::file_mapping mapping_;  ///< mapping of the file
+  boost::interprocess::mapped_region region_;  ///< mapped region of the whole file
+};
+
+/**
+ * @brief Source XML file of a binary file
+ */
+struct Source {
+  std::string path;         ///< canonical absolute path of the file, empty if there is no file
+  uint64_t size = 0;        ///< size of the file
+  std::string fingerprint;  ///< fingerprint of the content of the file
+};
+
+/**
+ * @brief Computes the path identifying a source XML file
+ *
+ * @param filepath the path of the file
+ * @returns the canonical absolute path of the file, empty if there is no file
+ */
+static std::string canonicalPath(const file::path &filepath) {
+  if (filepath.empty()) {
+    return "";
+  }
+  boost::system::error_code ec;
+  const auto &canonical = file::weakly_canonical(file::absolute(filepath), ec);
+  return ec ? file::absolute(filepath).generic_string() : canonical.generic_string();
+}
+
+/**
+ * @brief Describe a source XML file
+ *
+ * @param filepath the path of the file
+ * @returns the description of the file, with an empty path if there is no file
+ */
+static Source describe(const file::path &filepath) {
+  Source source;
+  source.path = canonicalPath(filepath);
+  if (!filepath.empty()) {
+    boost::system::error_code ec;
+    const auto size = file::file_size(filepath, ec);
+    source.size = ec ? 0 : static_cast<uint64_t>(size);
+    source.fingerprint = common::Fingerprint::ofFile(filepath);
+  }
+  return source;
+}
+
+/**
+ * @brief Determines whether a source XML file is still the one a binary file was compiled from
+ *
+ * The path and the size are compared first, so that the content is hashed only when they are unchanged
+ *
+ * @param source the description of the file in the binary file
+ * @param filepath the path of the file
+ * @returns true if the file has the same canonical path, size and content as when the binary file was compiled
+ */
+static bool isUnchanged(const Source &source, const file::path &filepath) {
+  if (source.path != canonicalPath(filepath)) {
+    return false;
+  }
+  if (filepath.empty()) {
+    return true;
+  }
+  boost::system::error_code ec;
+  const auto size = file::file_size(filepath, ec);
+  return !ec && static_cast<uint64_t>(size) == source.size && common::Fingerprint::ofFile(filepath) == source.fingerprint;
+}
+
+/**
+ * @brief Read the header of a binary file
+ *
+ * @param reader the reader at the start of the file
+ * @param setting the description of the setting file the binary file was compiled from
+ * @param assembling the description of the assembling file the binary file was compiled from
+ */
+static void readHeader(Reader &reader, Source &setting, Source &assembling) {
+  char fileMagic[sizeof(magic)];
+  reader.raw(fileMagic, sizeof(fileMagic));
+  if (std::memcmp(fileMagic, magic, sizeof(magic)) != 0 || reader.pod<uint32_t>() != formatVersion || reader.pod<uint32_t>() != byteOrderMark) {
+    throw MalformedFile();
+  }
+  for (auto source : {&setting, &assembling}) {
+    reader.string(source->path);
+    source->size = reader.pod<uint64_t>();
+    reader.string(source->fingerprint);
+  }
+}
+
+// Values
+
+static void write(Writer &writer, const std::string &value) {
+  writer.size(value.size());
+  writer.raw(value.data(), value.size());
+}
+
+static void write(Writer &writer, bool value) { writer.pod<uint8_t>(value ? 1 : 0); }
+
+static void write(Writer &writer, int value) { writer.pod<int32_t>(value); }
+
+static void write(Writer &writer, double value) { writer.pod<double>(value); }
+
+static void read(Reader &reader, std::string &value) { reader.string(value); }
+
+static void read(Reader &reader, bool &value) { value = reader.pod<uint8_t>() != 0; }
+
+static void read(Reader &reader, int &value) { value = reader.pod<int32_t>(); }
+
+static void read(Reader &reader, double &value) { value = reader.pod<double>(); }
+
+template<class T>
+static void write(Writer &writer, const boost::optional<T> &value);
+template<class T>
+static void write(Writer &writer, const std::vector<T> &values);
+template<class T>
+static void read(Reader &reader, boost::optional<T> &value);
+template<class T>
+static void read(Reader &reader, std::vector<T> &values);
+
+// Setting database
+
+template<class T>
+static void write(Writer &writer, const SettingDataBase::Parameter<T> &parameter) {
+  write(writer, parameter.name);
+  write(writer, parameter.value);
+}
+
+static void write(Writer &writer, const SettingDataBase::Count &count) {
+  write(writer, count.name);
+  write(writer, count.id);
+}
+
+static void write(Writer &writer, const SettingDataBase::Ref &ref) {
+  write(writer, ref.id);
+  write(writer, ref.name);
+  write(writer, ref.tag);
+}
+
+static void write(Writer &writer, const SettingDataBase::Reference &reference) {
+  write(writer, reference.componentId);
+  write(writer, reference.name);
+  write(writer, reference.origName);
+  writer.pod<uint8_t>(static_cast<uint8_t>(reference.dataType));
+}
+
+static void write(Writer &writer, const SettingDataBase::Set &set) {
+  write(writer, set.id);
+  write(writer, set.counts);
+  write(writer, set.refs);
+  write(writer, set.references);
+  write(writer, set.doubleParameters());
+  write(writer, set.boolParameters);
+  write(writer, set.integerParameters);
+  write(writer, set.stringParameters);
+}
+
+template<class T>
+static void read(Reader &reader, SettingDataBase::Parameter<T> &parameter) {
+  read(reader, parameter.name);
+  read(reader, parameter.value);
+}
+
+static void read(Reader &reader, SettingDataBase::Count &count) {
+  read(reader, count.name);
+  read(reader, count.id);
+}
+
+static void read(Reader &reader, SettingDataBase::Ref &ref) {
+  read(reader, ref.id);
+  read(reader, ref.name);
+  read(reader, ref.tag);
+}
+
+static void read(Reader &reader, SettingDataBase::Reference &reference) {
+  read(reader, reference.componentId);
+  read(reader, reference.name);
+  read(reader, reference.origName);
+  const uint8_t dataType = reader.pod<uint8_t>();
+  if (dataType > static_cast<uint8_t>(SettingDataBase::Reference::DataType::STRING)) {
+    throw MalformedFile();
+  }
+  reference.dataType = static_cast<SettingDataBase::Reference::DataType>(dataType);
+}
+
+static void read(Reader &reader, SettingDataBase::Set &set) {
+  read(reader, set.id);
+  read(reader, set.counts);
+  read(reader, set.refs);
+  read(reader, set.references);
+  std::vector<SettingDataBase::Parameter<double>> doubleParameters;
+  read(reader, doubleParameters);
+  set.setDoubleParameters(std::move(doubleParameters));
+  read(reader, set.boolParameters);
+  read(reader, set.integerParameters);
+  read(reader, set.stringParameters);
+}
+
+// Assembling database
+
+static void write(Writer &writer, const AssemblingDataBase::Connection &connection) {
+  write(writer, connection.var1);
+  write(writer, connection.var2);
+}
+
+static void write(Writer &writer, const AssemblingDataBase::Bus &bus) { write(writer, bus.voltageLevel); }
+
+static void write(Writer &writer, const AssemblingDataBase::MultipleShunts &shunts) { write(writer, shunts.voltageLevel); }
+
+static void write(Writer &writer, const AssemblingDataBase::Generator &generator) { write(writer, generator.name); }
+
+static void write(Writer &writer, const AssemblingDataBase::Load &load) { write(writer, load.name); }
+
+static void write(Writer &writer, const AssemblingDataBase::Tfo &tfo) { write(writer, tfo.name); }
+
+static void write(Writer &writer, const AssemblingDataBase::SingleShunt &shunt) { write(writer, shunt.name); }
+
+static void write(Writer &writer, const AssemblingDataBase::Line &line) { write(writer, line.name); }
+
+static void write(Writer &writer, const AssemblingDataBase::HvdcLine &hvdcLine) {
+  write(writer, hvdcLine.name);
+  writer.pod<uint8_t>(static_cast<uint8_t>(hvdcLine.converterStation1));
+}
+
+static void write(Writer &writer, const AssemblingDataBase::MacroConnect &macroConnect) {
+  write(writer, macroConnect.macroConnection);
+  write(writer, macroConnect.id);
+  write(writer, macroConnect.mandatory);
+}
+
+static void write(Writer &writer, const AssemblingDataBase::MacroConnection &macroConnection) {
+  write(writer, macroConnection.id);
+  write(writer, macroConnection.network);
+  write(writer, macroConnection.indexId);
+  write(writer, macroConnection.connections);
+}
+
+static void write(Writer &writer, const AssemblingDataBase::SingleAssociation &association) {
+  write(writer, association.id);
+  write(writer, association.bus);
+  write(writer, association.tfo);
+  write(writer, association.line);
+  write(writer, association.hvdcLine);
+  write(writer, association.shunt);
+  write(writer, association.generators);
+  write(writer, association.loads);
+}
+
+static void write(Writer &writer, const AssemblingDataBase::MultipleAssociation &association) {
+  write(writer, association.id);
+  write(writer, association.shunt);
+}
+
+static void write(Writer &writer, const AssemblingDataBase::DynamicAutomaton &automaton) {
+  write(writer, automaton.id);
+  write(writer, automaton.lib);
+  write(writer, automaton.macroConnects);
+}
+
+static void write(Writer &writer, const AssemblingDataBase::Device &device) { write(writer, device.id); }
+
+static void write(Writer &writer, const AssemblingDataBase::Property &property) {
+  write(writer, property.id);
+  write(writer, property.devices);
+}
+
+static void read(Reader &reader, AssemblingDataBase::Connection &connection) {
+  read(reader, connection.var1);
+  read(reader, connection.var2);
+}
+
+static void read(Reader &reader, AssemblingDataBase::Bus &bus) { read(reader, bus.voltageLevel); }
+
+static void read(Reader &reader, AssemblingDataBase::MultipleShunts &shunts) { read(reader, shunts.voltageLevel); }
+
+static void read(Reader &reader, AssemblingDataBase::Generator &generator) { read(reader, generator.name); }
+
+static void read(Reader &reader, AssemblingDataBase::Load &load) { read(reader, load.name); }
+
+static void read(Reader &reader, AssemblingDataBase::Tfo &tfo) { read(reader, tfo.name); }
+
+static void read(Reader &reader, AssemblingDataBase::SingleShunt &shunt) { read(reader, shunt.name); }
+
+static void read(Reader &reader, AssemblingDataBase::Line &line) { read(reader, line.name); }
+
+static void read(Reader &reader, AssemblingDataBase::HvdcLine &hvdcLine) {
+  read(reader, hvdcLine.name);
+  const uint8_t side = reader.pod<uint8_t>();
+  if (side > static_cast<uint8_t>(AssemblingDataBase::HvdcLineConverterSide::SIDE2)) {
+    throw MalformedFile();
+  }
+  hvdcLine.converterStation1 = static_cast<AssemblingDataBase::HvdcLineConverterSide>(side);
+}
+
+static void read(Reader &reader, AssemblingDataBase::MacroConnect &macroConnect) {
+  read(reader, macroConnect.macroConnection);
+  read(reader, macroConnect.id);
+  read(reader, macroConnect.mandatory);
+}
+
+static void read(Reader &reader, AssemblingDataBase::MacroConnection &macroConnection) {
+  read(reader, macroConnection.id);
+  read(reader, macroConnection.network);
+  read(reader, macroConnection.indexId);
+  read(reader, macroConnection.connections);
+}
+
+static void read(Reader &reader, AssemblingDataBase::SingleAssociation &association) {
+  read(reader, association.id);
+  read(reader, association.bus);
+  read(reader, association.tfo);
+  read(reader, association.line);
+  read(reader, association.hvdcLine);
+  read(reader, association.shunt);
+  read(reader, association.generators);
+  read(reader, association.loads);
+}
+
+static void read(Reader &reader, AssemblingDataBase::MultipleAssociation &association) {
+  read(reader, association.id);
+  read(reader, association.shunt);
+}
+
+static void read(Reader &reader, AssemblingDataBase::DynamicAutomaton &automaton) {
+  read(reader, automaton.id);
+  read(reader, automaton.lib);
+  read(reader, automaton.macroConnects);
+}
+
+static void read(Reader &reader, AssemblingDataBase::Device &device) { read(reader, device.id); }
+
+static void read(Reader &reader, AssemblingDataBase::Property &property) {
+  read(reader, property.id);
+  read(reader, property.devices);
+}
+
+// Containers, defined last so that every element type is known
+
+template<class T>
+static void write(Writer &writer, const boost::optional<T> &value) {
+  write(writer, static_cast<bool>(value));
+  if (value) {
+    write(writer, *value);
+  }
+}
+
+template<class T>
+static void write(Writer &writer, const std::vector<T> &values) {
+  writer.size(values.size());
+  for (const auto &value : values) {
+    write(writer, value);
+  }
+}
+
+/**
+ * @brief Write the values of a map, the keys being part of the values
+ *
+ * @param writer the writer
+ * @param map the map to write
+ */
+template<class Map>
+static void writeValues(Writer &writer, const Map &map) {
+  writer.size(map.size());
+  for (const auto &entry : map) {
+    write(writer, entry.second);
+  }
+}
+
+/**
+ * @brief Write a map of strings
+ *
+ * @param writer the writer
+ * @param map the map to write
+ */
+static void writeStrings(Writer &writer, const std::unordered_map<std::string, std::string> &map) {
+  writer.size(map.size());
+  for (const auto &entry : map) {
+    write(writer, entry.first);
+    write(writer, entry.second);
+  }
+}
+
+template<class T>
+static void read(Reader &reader, boost::optional<T> &value) {
+  bool present;
+  read(reader, present);
+  if (present) {
+    value = T();
+    read(reader, *value);
+  } else {
+    value.reset();
+  }
+}
+
+template<class T>
+static void read(Reader &reader, std::vector<T> &values) {
+  // each element is at least one byte long
+  values.resize(reader.size(1));
+  for (auto &value : values) {
+    read(reader, value);
+  }
+}
+
+/**
+ * @brief Read the values of a map, the keys being the ids of the values
+ *
+ * @param reader the reader
+ * @param map the map to fill
+ */
+template<class Map>
+static void readValues(Reader &reader, Map &map) {
+  const std::size_t size = reader.size(1);
+  for (std::size_t i = 0; i < size; ++i) {
+    typename Map::mapped_type value;
+    read(reader, value);
+    map[value.id] = std::move(value);
+  }
+}
+
+/**
+ * @brief Read a map of strings
+ *
+ * @param reader the reader
+ * @param map the map to fill
+ */
+static void readStrings(Reader &reader, std::unordered_map<std::string, std::string> &map) {
+  const std::size_t size = reader.size(1);
+  for (std::size_t i = 0; i < size; ++i) {
+    std::string key;
+    read(reader, key);
+    read(reader, map[key]);
+  }
+}
+
+}  // namespace helper
+
+file::path DynamicDataBaseBinary::binaryPath(const file::path &settingFilePath, const file::path &assemblingFilePath) {
+  const file::path &path = assemblingFilePath.empty() ? settingFilePath : assemblingFilePath;
+  if (path.empty()) {
+    return path;
+  }
+  // both files are part of the name, so that an assembling file used with several setting files has a binary file for each of them
+  common::Fingerprint fingerprint;
+  fingerprint << helper::canonicalPath(settingFilePath) << helper::canonicalPath(assemblingFilePath);
+  return path.parent_path() / (path.stem().generic_string() + "-" + fingerprint.str().substr(0, 16) + ".ddb");
+}
+
+bool DynamicDataBaseBinary::isUpToDate(const file::path &binaryFilePath, const file::path &settingFilePath, const file::path &assemblingFilePath) {
+  boost::system::error_code ec;
+  if (binaryFilePath.empty() || !file::is_regular_file(binaryFilePath, ec)) {
+    return false;
+  }
+
+  try {
+    helper::MappedFile mappedFile(binaryFilePath);
+    helper::Reader reader = mappedFile.reader();
+    helper::Source setting;
+    helper::Source assembling;
+    helper::readHeader(reader, setting, assembling);
+    return helper::isUnchanged(setting, settingFilePath) && helper::isUnchanged(assembling, assemblingFilePath);
+  } catch (const helper::MalformedFile &) {
+    return false;
+  } catch (const boost::interprocess::interprocess_exception &) {
+    return false;
+  }
+}
+
+void DynamicDataBaseBinary::write(const file::path &binaryFilePath, const file::path &settingFilePath, const file::path &assemblingFilePath,
+                                  const SettingDataBase &setting, const AssemblingDataBase &assembling) {
+  file::path tmpFilePath(binaryFilePath.parent_path());
+  tmpFilePath /= file::unique_path(".tmp-%%%%-%%%%-%%%%-%%%%");
+  {
+    std::ofstream ofs(tmpFilePath.generic_string(), std::ios::binary);
+    helper::Writer writer(ofs);
+    writer.raw(helper::magic, sizeof(helper::magic));
+    writer.pod(helper::formatVersion);
+    writer.pod(helper::byteOrderMark);
+    for (const auto &source : {helper::describe(settingFilePath), helper::describe(assemblingFilePath)}) {
+      helper::write(writer, source.path);
+      writer.pod(source.size);
+      helper::write(writer, source.fingerprint);
+    }
+
+    helper::writeValues(writer, setting.sets_);
+
+    // network and other macro connections are told apart by their network attribute
+    writer.size(assembling.macroConnections_.size() + assembling.networkMacroConnections_.size());
+    for (const auto &macroConnection : assembling.macroConnections_) {
+      helper::write(writer, macroConnection.second);
+    }
+    for (const auto &macroConnection : assembling.networkMacroConnections_) {
+      helper::write(writer, macroConnection.second);
+    }
+    helper::writeValues(writer, assembling.singleAssociations_);
+    helper::writeValues(writer, assembling.multipleAssociations_);
+    helper::writeStrings(writer, assembling.generatorIdToSingleAssociationsId_);
+    helper::writeStrings(writer, assembling.HvdcIdToSingleAssociationsId_);
+    helper::writeValues(writer, assembling.dynamicAutomatons_);
+    helper::write(writer, assembling.containsSVC_);
+    helper::writeValues(writer, assembling.properties_);
+
+    ofs.close();
+    if (!ofs) {
+      boost::system::error_code ec;
+      file::remove(tmpFilePath, ec);
+      throw Error(DynModelBinaryWriteError, binaryFilePath.generic_string());
+    }
+  }
+  file::rename(tmpFilePath, binaryFilePath);
+}
+
+bool DynamicDataBaseBinary::read(const file::path &binaryFilePath, SettingDataBase &setting, AssemblingDataBase &assembling) {
+  SettingDataBase settingRead;
+  AssemblingDataBase assemblingRead;
+  try {
+    helper::MappedFile mappedFile(binaryFilePath);
+    helper::Reader reader = mappedFile.reader();
+    helper::Source settingSource;
+    helper::Source assemblingSource;
+    helper::readHeader(reader, settingSource, assemblingSource);
+
+    helper::readValues(reader, settingRead.sets_);
+
+    const std::size_t nbMacroConnections = reader.size(1);
+    for (std::size_t i = 0; i < nbMacroConnections; ++i) {
+      AssemblingDataBase::MacroConnection macroConnection;
+      helper::read(reader, macroConnection);
+      auto &macroConnections = macroConnection.network ? assemblingRead.networkMacroConnections_ : assemblingRead.macroConnections_;
+      macroConnections[macroConnection.id] = std::move(macroConnection);
+    }
+    helper::readValues(reader, assemblingRead.singleAssociations_);
+    helper::readValues(reader, assemblingRead.multipleAssociations_);
+    helper::readStrings(reader, assemblingRead.generatorIdToSingleAssociationsId_);
+    helper::readStrings(reader, assemblingRead.HvdcIdToSingleAssociationsId_);
+    helper::readValues(reader, assemblingRead.dynamicAutomatons_);
+    helper::read(reader, assemblingRead.containsSVC_);
+    helper::readValues(reader, assemblingRead.properties_);
+    if (!reader.atEnd()) {
+      return false;
+    }
+  } catch (const helper::MalformedFile &) {
+    return false;
+  } catch (const boost::interprocess::interprocess_exception &) {
+    return false;
+  }
+
+  setting = std::move(settingRead);
+  assembling = std::move(assemblingRead);
+  assembling.buildIndexes();
+  return true;
+}
+
+}  // namespace inputs
+}  // namespace dfl
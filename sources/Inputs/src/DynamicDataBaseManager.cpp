@@ -17,12 +17,35 @@
 
 #include "DynamicDataBaseManager.h"
 
+#include "DynamicDataBaseBinary.h"
+#include "Log.h"
+#include "Parallel.h"
+
+#include <libxml/parser.h>
+
 namespace dfl {
 namespace inputs {
 
-DynamicDataBaseManager::DynamicDataBaseManager(const boost::filesystem::path& settingFilePath, const boost::filesystem::path& assemblingFilePath) :
-    assembling_(assemblingFilePath),
-    setting_(settingFilePath) {}
+DynamicDataBaseManager::DynamicDataBaseManager(const boost::filesystem::path& settingFilePath, const boost::filesystem::path& assemblingFilePath) {
+  // the binary file compiled from the XML files is used as long as they did not change since
+  const auto& binaryFilePath = DynamicDataBaseBinary::binaryPath(settingFilePath, assemblingFilePath);
+  if (DynamicDataBaseBinary::isUpToDate(binaryFilePath, settingFilePath, assemblingFilePath)) {
+    if (DynamicDataBaseBinary::read(binaryFilePath, setting_, assembling_)) {
+      LOG(info, DynModelBinaryLoaded, binaryFilePath.generic_string());
+      return;
+    }
+    LOG(warn, DynModelBinaryUnreadable, binaryFilePath.generic_string());
+  }
+  // the assembling and setting files are independent: they are parsed concurrently, libxml2 being initialized by a single thread first
+  xmlInitParser();
+  common::runParallel(2, 2, [this, &settingFilePath, &assemblingFilePath](std::size_t index) {
+    if (index == 0) {
+      assembling_ = AssemblingDataBase(assemblingFilePath);
+    } else {
+      setting_ = SettingDataBase(settingFilePath);
+    }
+  });
+}
 
 }  // namespace inputs
 
@@ -16,8 +16,11 @@
 #include "SettingDataBase.h"
 
 #include "Log.h"
+#include "XsdValidationStamp.h"
 
+#include <algorithm>
 #include <boost/optional.hpp>
+#include <cctype>
 #include <xml/sax/parser/ParserFactory.h>
 
 namespace parser = xml::sax::parser;
@@ -78,9 +81,13 @@ SettingDataBase::SettingDataBase(const boost::filesystem::path &settingFilePath)
   }
 
   auto xsd = computeXsdPath(settingFilePath);
+  XsdValidationStamp stamp(settingFilePath, xsd);
   if (xsd.empty()) {
     LOG(warn, DynModelFileXSDNotFound, settingFilePath.generic_string());
     xsdValidation = false;
+  } else if (stamp.isValidated()) {
+    LOG(debug, DynModelFileValidationSkipped, settingFilePath.generic_string());
+    xsdValidation = false;
   } else {
     parser->addXmlSchema(xsd.generic_string());
   }
@@ -90,6 +97,9 @@ SettingDataBase::SettingDataBase(const boost::filesystem::path &settingFilePath)
   } catch (const xml::sax::parser::ParserException &e) {
     throw Error(DynModelFileReadError, settingFilePath.generic_string(), e.what());
   }
+  if (xsdValidation) {
+    stamp.setValidated();
+  }
 }
 
 const SettingDataBase::Set &SettingDataBase::getSet(const std::string &id) const {
@@ -99,6 +109,80 @@ const SettingDataBase::Set &SettingDataBase::getSet(const std::string &id) const
   throw Error(UnknownParamSet, id);
 }
 
+namespace helper {
+
+/**
+ * @brief Decode the name of an indexed parameter, named <family><index>_
+ * @param name the parameter name
+ * @param family the name of the parameter before its index, ending with '_'
+ * @param index the index of the parameter
+ * @returns true if the name is the one of an indexed parameter, false otherwise
+ */
+static bool decodeIndexedName(const std::string &name, std::string &family, unsigned int &index) {
+  // the index is written without leading zero, so that the decoded parameter has the name built from its family and its index
+  const std::size_t maxDigits = 9;
+  if (name.size() < 3 || name.back() != '_')
+    return false;
+  std::size_t first = name.size() - 1;
+  while (first > 0 && std::isdigit(static_cast<unsigned char>(name[first - 1])))
+    --first;
+  const std::size_t nbDigits = name.size() - 1 - first;
+  if (nbDigits == 0 || nbDigits > maxDigits || first < 2 || name[first - 1] != '_' || (nbDigits > 1 && name[first] == '0'))
+    return false;
+  family = name.substr(0, first);
+  index = static_cast<unsigned int>(std::stoul(name.substr(first, nbDigits)));
+  return true;
+}
+
+}  // namespace helper
+
+void SettingDataBase::Set::setDoubleParameters(std::vector<Parameter<double>> &&parameters) {
+  doubleParameters_ = std::move(parameters);
+  buildIndexes();
+}
+
+void SettingDataBase::Set::buildIndexes() {
+  doubleParameterIndexes_.clear();
+  indexedDoubleParameters_.clear();
+  doubleParameterIndexes_.reserve(doubleParameters_.size());
+  std::string family;
+  unsigned int index = 0;
+  for (std::size_t i = 0; i < doubleParameters_.size(); ++i) {
+    const auto &param = doubleParameters_[i];
+    // as when searching the list, the first parameter with a name is used
+    doubleParameterIndexes_.emplace(param.name, i);
+    // as when the SVC parameters were copied into a map, the last indexed parameter with a name is used
+    // the arrays are bounded by the number of parameters: parameters with higher indexes are searched in the list
+    if (helper::decodeIndexedName(param.name, family, index) && index < doubleParameters_.size()) {
+      auto &values = indexedDoubleParameters_[family];
+      if (values.size() <= index)
+        values.resize(index + 1);
+      values[index] = param.value;
+    }
+  }
+}
+
+const SettingDataBase::Parameter<double> *SettingDataBase::Set::findDoubleParameter(const std::string &name) const {
+  const auto it = doubleParameterIndexes_.find(name);
+  if (it == doubleParameterIndexes_.end())
+    return nullptr;
+  return &doubleParameters_[it->second];
+}
+
+boost::optional<double> SettingDataBase::Set::getIndexedDoubleParameter(const std::string &family, unsigned int index) const {
+  if (index < doubleParameters_.size()) {
+    const auto it = indexedDoubleParameters_.find(family);
+    if (it == indexedDoubleParameters_.end() || index >= it->second.size())
+      return boost::none;
+    return it->second[index];
+  }
+  const std::string name = family + std::to_string(index) + "_";
+  const auto it = std::find_if(doubleParameters_.rbegin(), doubleParameters_.rend(), [&name](const Parameter<double> &param) { return param.name == name; });
+  if (it == doubleParameters_.rend())
+    return boost::none;
+  return it->value;
+}
+
 /**
  * @brief Specialization for string of @a createOptionalParameter
  * @param param the parameter to update
@@ -117,6 +201,8 @@ SettingDataBase::SettingXmlDocument::SettingXmlDocument(SettingDataBase &db) : s
 
   setHandler_.onStart([this]() { setHandler_.currentSet = Set(); });
   setHandler_.onEnd([this, &db]() {
+    setHandler_.currentSet->setDoubleParameters(std::move(setHandler_.currentDoubleParameters));
+    setHandler_.currentDoubleParameters.clear();
     db.sets_[setHandler_.currentSet->id] = *setHandler_.currentSet;
     setHandler_.currentSet.reset();
   });
@@ -156,7 +242,7 @@ SettingDataBase::SettingXmlDocument::SetHandler::SetHandler(const elementName_ty
     if (parameterHandler.currentBoolParameter) {
       currentSet->boolParameters.push_back(*parameterHandler.currentBoolParameter);
     } else if (parameterHandler.currentDoubleParameter) {
-      currentSet->doubleParameters.push_back(*parameterHandler.currentDoubleParameter);
+      currentDoubleParameters.push_back(*parameterHandler.currentDoubleParameter);
     } else if (parameterHandler.currentIntegerParameter) {
       currentSet->integerParameters.push_back(*parameterHandler.currentIntegerParameter);
     } else if (parameterHandler.currentStringParameter) {
@@ -0,0 +1,54 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  XsdValidationStamp.cpp
+ *
+ * @brief Stamp of a document already validated against its XSD
+ *
+ */
+
+#include "XsdValidationStamp.h"
+
+#include "Fingerprint.h"
+
+#include <cstdlib>
+#include <fstream>
+
+namespace file = boost::filesystem;
+
+namespace dfl {
+namespace inputs {
+
+XsdValidationStamp::XsdValidationStamp(const file::path &documentPath, const file::path &xsdPath) {
+  auto force = getenv("DYNAFLOW_LAUNCHER_FORCE_XSD_VALIDATION");
+  forced_ = force != NULL && std::string(force) == "true";
+  auto cacheDir = getenv("DYNAFLOW_LAUNCHER_XSD_VALIDATION_CACHE");
+  if (cacheDir == NULL || std::string(cacheDir).empty() || xsdPath.empty()) {
+    return;
+  }
+  stampPath_ = file::path(cacheDir);
+  stampPath_.append(common::Fingerprint::ofFile(documentPath) + "-" + common::Fingerprint::ofFile(xsdPath));
+}
+
+bool XsdValidationStamp::isValidated() const { return !forced_ && !stampPath_.empty() && file::exists(stampPath_); }
+
+void XsdValidationStamp::setValidated() const {
+  if (stampPath_.empty()) {
+    return;
+  }
+  boost::system::error_code ec;
+  file::create_directories(stampPath_.parent_path(), ec);
+  // the stamp is empty, so that it is never partially written
+  std::ofstream ofs(stampPath_.generic_string());
+}
+
+}  // namespace inputs
+}  // namespace dfl
@@ -0,0 +1,94 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  CompilationCache.h
+ *
+ * @brief Dynaflow launcher cache of the compiled dynamic models header file
+ *
+ */
+
+#pragma once
+
+#include <boost/filesystem.hpp>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace dfl {
+namespace outputs {
+
+/**
+ * @brief Cache of the dynamic models compiled by the simulations, shared by successive runs and by concurrent processes
+ *
+ * Each entry is a directory named after the key, holding the files of a compilation directory. The files of an entry are restored in
+ * the compilation directory of a simulation before it starts, and the files compiled by the simulation are added to the entry, each one
+ * under a temporary name renamed once complete. A lock file of the cache is held shared while restoring and exclusive while storing and
+ * evicting, so that concurrent processes never remove an entry being read. The size of the cache is bounded by removing the least
+ * recently used entries.
+ */
+class CompilationCache {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param directory the directory of the cache
+   * @param maxSize the maximum size of the cache in bytes
+   */
+  CompilationCache(const boost::filesystem::path& directory, uint64_t maxSize);
+
+  /**
+   * @brief Copy the compiled files of an entry in a compilation directory
+   *
+   * Files already present in the compilation directory are kept
+   *
+   * @param key the fingerprint of the models to compile
+   * @param compileDirectory the compilation directory of the simulation
+   * @returns the number of restored files
+   */
+  std::size_t restore(const std::string& key, const boost::filesystem::path& compileDirectory) const;
+
+  /**
+   * @brief Add the files of a compilation directory missing in an entry
+   *
+   * @param key the fingerprint of the models to compile
+   * @param compileDirectory the compilation directory of the simulation
+   * @returns the number of stored files
+   */
+  std::size_t store(const std::string& key, const boost::filesystem::path& compileDirectory) const;
+
+  /**
+   * @brief Remove the least recently used entries until the cache fits in its maximum size
+   */
+  void evict() const;
+
+ private:
+  /**
+   * @brief Retrieves the directory of an entry
+   *
+   * @param key the fingerprint of the models to compile
+   * @returns the directory of the entry, which also depends on the version of the launcher
+   */
+  boost::filesystem::path entryDirectory(const std::string& key) const;
+
+  /**
+   * @brief Retrieves the lock file of the cache, created if needed
+   *
+   * @returns the path of the lock file
+   */
+  boost::filesystem::path lockFile() const;
+
+  boost::filesystem::path directory_;  ///< directory of the cache
+  uint64_t maxSize_;                   ///< maximum size of the cache in bytes
+  mutable std::mutex mutex_;           ///< lock of the cache between the threads of the process, as file locks are held by processes
+};
+
+}  // namespace outputs
+}  // namespace dfl
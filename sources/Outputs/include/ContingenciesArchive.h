@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ContingenciesArchive.h
+ *
+ * @brief Dynaflow launcher security analysis contingencies archive header file
+ *
+ */
+
+#pragma once
+
+#include <boost/filesystem.hpp>
+#include <string>
+#include <vector>
+
+namespace dfl {
+namespace outputs {
+
+/**
+ * @brief Compressed archive of the security analysis files of each contingency
+ *
+ * The archive is a zip file, written in a streaming way entry after entry. Each entry is stored under "<contingency id>/" followed by
+ * the path of the file relative to the output directory, and an index entry lists the files of each contingency and the offset of its first entry.
+ */
+class ContingenciesArchive {
+ public:
+  /**
+   * @brief Contingencies archive definition
+   */
+  struct ContingenciesArchiveDefinition {
+    /**
+     * @brief Constructor
+     *
+     * @param base the basename of the simulation
+     * @param outputDir the output directory containing the security analysis files
+     * @param contingencyIds the ids of the simulated contingencies
+     * @param removeFiles whether the archived files are removed from the output directory
+     */
+    ContingenciesArchiveDefinition(const std::string& base, const boost::filesystem::path& outputDir, const std::vector<std::string>& contingencyIds,
+                                   bool removeFiles) :
+        basename(base),
+        outputDir(outputDir),
+        contingencyIds(contingencyIds),
+        removeFiles(removeFiles) {}
+
+    std::string basename;                     ///< basename of the simulation
+    boost::filesystem::path outputDir;        ///< output directory
+    std::vector<std::string> contingencyIds;  ///< ids of the contingencies to archive
+    bool removeFiles;                         ///< whether the archived files are removed
+  };
+
+  /**
+   * @brief Constructor
+   *
+   * @param def the contingencies archive definition
+   */
+  explicit ContingenciesArchive(ContingenciesArchiveDefinition&& def);
+
+  /**
+   * @brief Pack the files of all the contingencies in the archive of the output directory
+   *
+   * Files are only removed once the archive has been fully written.
+   */
+  void write() const;
+
+  /**
+   * @brief Extract the files of a single contingency from an archive
+   *
+   * Files are restored with their path relative to the output directory. Only the entries of the contingency are read, from the offset
+   * given by the index, and entries which would be extracted outside of the destination directory are rejected.
+   *
+   * @param archivePath the path of the archive
+   * @param contingencyId the id of the contingency to extract
+   * @param destinationDir the directory where the files are extracted
+   * @returns the paths of the extracted files
+   */
+  static std::vector<boost::filesystem::path> extract(const boost::filesystem::path& archivePath, const std::string& contingencyId,
+                                                      const boost::filesystem::path& destinationDir);
+
+ private:
+  /**
+   * @brief List the files of a contingency
+   *
+   * @param contingencyId the id of the contingency
+   * @returns the paths of the files relative to the output directory
+   */
+  std::vector<boost::filesystem::path> listFiles(const std::string& contingencyId) const;
+
+  ContingenciesArchiveDefinition def_;  ///< contingencies archive definition
+};
+
+}  // namespace outputs
+}  // namespace dfl
@@ -0,0 +1,76 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ContingenciesHistory.h
+ *
+ * @brief Dynaflow launcher security analysis contingencies history header file
+ *
+ */
+
+#pragma once
+
+#include <boost/filesystem.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace dfl {
+namespace outputs {
+
+/**
+ * @brief Append-only history of the contingencies simulations of the successive security analyses
+ *
+ * The history is a binary file starting with a header, followed by one record per simulated contingency and per run. Values are stored
+ * in little endian whatever the platform. Records of a run are appended with a single write, under a lock of the file shared with the other
+ * launchers. A record truncated by an interrupted write is ignored when reading, and dropped before the next records are appended.
+ */
+class ContingenciesHistory {
+ public:
+  /**
+   * @brief Record of the simulation of a contingency
+   */
+  struct Record {
+    int64_t timestamp;          ///< end of the security analysis, in seconds since epoch
+    std::string contingencyId;  ///< contingency id
+    std::string fingerprint;    ///< fingerprint of the inputs of the simulation
+    std::string status;         ///< final status of the simulation
+    double wallTime;            ///< wall time of the simulation in seconds, negative when it was not measured
+  };
+
+  /**
+   * @brief Constructor
+   *
+   * @param filepath the path of the history file
+   */
+  explicit ContingenciesHistory(const boost::filesystem::path& filepath);
+
+  /**
+   * @brief Append records at the end of the history, creating it if needed
+   *
+   * A record truncated by an interrupted write at the end of the history is removed first.
+   *
+   * @param records the records to append
+   */
+  void append(const std::vector<Record>& records) const;
+
+  /**
+   * @brief Read all the records of the history
+   *
+   * @returns the records, in the order they were appended
+   */
+  std::vector<Record> read() const;
+
+ private:
+  boost::filesystem::path filepath_;  ///< path of the history file
+};
+
+}  // namespace outputs
+}  // namespace dfl
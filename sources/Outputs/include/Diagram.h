@@ -19,6 +19,7 @@
 
 #include "GeneratorDefinitionAlgorithm.h"
 #include "HVDCDefinitionAlgorithm.h"
+#include "Manifest.h"
 
 #include <string>
 #include <vector>
@@ -51,9 +52,8 @@ class Diagram {
 
     const std::string basename;       ///< basename for file
     const std::string directoryPath;  ///< directory path for files to write
-    // non const copies instead of const references because we need to modify them before use
-    std::vector<algo::GeneratorDefinition> generators;  ///< generators found
-    algo::HVDCLineDefinitions hvdcDefinitions;          ///< HVDC definitions
+    const std::vector<algo::GeneratorDefinition>& generators;  ///< generators found, with curve points already sorted by p
+    const algo::HVDCLineDefinitions& hvdcDefinitions;          ///< HVDC definitions, with curve points already sorted by p
   };
 
   /**
@@ -68,6 +68,13 @@ class Diagram {
    */
   void write() const;
 
+  /**
+   * @brief Write the Diagram files which are not up to date according to the manifest
+   *
+   * @param manifest the manifest of the output directory, updated with the diagram files
+   */
+  void write(Manifest& manifest) const;
+
  private:
   /// @brief Different tables in the diagram, qmin or qmax
   enum class Tables {
@@ -103,24 +110,43 @@ class Diagram {
   template<class T>
   static void writeTable(const T& element, std::stringstream& buffer, Tables table);
 
-  /// @brief Write generator diagrams
-  void writeGenerators() const;
-  /// @brief Write VSC converters diagrams
-  void writeConverters() const;
+  /**
+   * @brief Write generator diagrams
+   * @param manifest the manifest of the output directory
+   */
+  void writeGenerators(Manifest& manifest) const;
+  /**
+   * @brief Write VSC converters diagrams
+   * @param manifest the manifest of the output directory
+   */
+  void writeConverters(Manifest& manifest) const;
 
   /**
    * @brief Write VSC converter diagram
    * @param vscDefinition the VSC definition to use
+   * @param manifest the manifest of the output directory
    */
-  void writeVSC(const dfl::algo::VSCDefinition& vscDefinition) const;
+  void writeVSC(const dfl::algo::VSCDefinition& vscDefinition, Manifest& manifest) const;
 
   /**
    * @brief Write LCC converter diagram
    * @param converterId the id of the LCC converter
    * @param powerFactor the power factor of the LCC
    * @param pMax the maximum p of the HVDC line which owns the LCC converter
+   * @param manifest the manifest of the output directory
+   */
+  void writeLCC(const algo::HVDCDefinition::ConverterId& converterId, double powerFactor, double pMax, Manifest& manifest) const;
+
+  /**
+   * @brief Write a diagram file, unless the manifest reports it as up to date
+   *
+   * The fingerprint of the diagram file is the fingerprint of its content, which is cheap to build
+   *
+   * @param id the id of the element owning the diagram
+   * @param buffer the content of the diagram file
+   * @param manifest the manifest of the output directory
    */
-  void writeLCC(const algo::HVDCDefinition::ConverterId& converterId, double powerFactor, double pMax) const;
+  void writeFile(const std::string& id, const std::stringstream& buffer, Manifest& manifest) const;
 
  private:
   DiagramDefinition def_;  ///< Diagram file information
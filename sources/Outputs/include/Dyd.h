@@ -75,7 +75,7 @@ class Dyd {
                   const std::vector<algo::LoadDefinition> &loaddefs, const std::shared_ptr<inputs::Node> &slacknode,
                   const algo::HVDCLineDefinitions &hvdcDefinitions, const inputs::NetworkManager::BusMapRegulating &busesToNumberOfRegulationMap,
                   const inputs::DynamicDataBaseManager &dynamicDataBaseManager, const algo::DynamicModelDefinitions &models,
-                  const std::vector<algo::StaticVarCompensatorDefinition> svarcsDefs)
+                  const std::vector<algo::StaticVarCompensatorDefinition> &svarcsDefs)
         : basename_(base), filename_(filepath), slackNode_(slacknode), dynamicDataBaseManager_(dynamicDataBaseManager), dydLoads_(new DydLoads(loaddefs)),
           dydSVarC_(new DydSVarC(svarcsDefs)), dydHvdc_(new DydHvdc(hvdcDefinitions)), dydGenerator_(new DydGenerator(gens)),
           dydDynModel_(new DydDynModel(models, gens, loaddefs, hvdcDefinitions)),
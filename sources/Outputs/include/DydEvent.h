@@ -84,6 +84,13 @@ class DydEvent {
    */
   void write() const;
 
+  /**
+   * @brief Computes the fingerprint of the dyd file inputs
+   *
+   * @returns the fingerprint
+   */
+  std::string fingerprint() const;
+
  private:
   /**
    * @brief Create black box model for disconnecting a branch
@@ -69,10 +69,12 @@ class DydGenerator {
    * @param dynamicModelsToConnect dynamic black models set collection to enrich
    * @param basename the basename for current file
    * @param slackNodeId id of slack node
+   * @param dynamicDataBaseManager the dynamic database manager, used to detect generators sharing identical parameters
    */
   void write(boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect,
               const std::string& basename,
-              const std::string& slackNodeId);
+              const std::string& slackNodeId,
+              const inputs::DynamicDataBaseManager& dynamicDataBaseManager);
 
  private:
   /**
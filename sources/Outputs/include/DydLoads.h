@@ -61,7 +61,7 @@ class DydLoads {
   void writeMacroStaticReference(boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect);
 
  private:
-  std::vector<algo::LoadDefinition> loadsDefinitions_;                  ///< list of loads definitions
+  const std::vector<algo::LoadDefinition>& loadsDefinitions_;           ///< list of loads definitions
   const std::string macroStaticRefLoadName_{"LoadRef"};                 ///< Name for the static ref macro for loads
   const std::string macroConnectorLoadName_{"LOAD_NETWORK_CONNECTOR"};  ///< name of the macro connector for loads
 };
@@ -87,7 +87,7 @@ class DydSVarC {
   void writeMacroStaticReference(boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect);
 
  private:
-  std::vector<algo::StaticVarCompensatorDefinition> svarcsDefinitions_;  ///< list of SVarCs definitions
+  const std::vector<algo::StaticVarCompensatorDefinition>& svarcsDefinitions_;  ///< list of SVarCs definitions
   static const std::unordered_map<algo::StaticVarCompensatorDefinition::ModelType, std::string>
       svarcModelsNames_;                                                             ///< Correspondance between svarcs model type and library name in dyd file
   const std::string macroConnectorSVarCName_{"StaticVarCompensatorMacroConnector"};  ///< constants for macro connector ids
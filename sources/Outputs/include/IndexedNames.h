@@ -0,0 +1,63 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  IndexedNames.h
+ *
+ * @brief Names of indexed parameters header file
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace dfl {
+namespace outputs {
+
+/**
+ * @brief Names of a family of indexed parameters, named <prefix><index>_
+ *
+ * Each name is built the first time its index is requested and kept afterwards, so that the names are not built again for each parameter set
+ */
+class IndexedNames {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param prefix the name of the parameters before their index, for example secondaryVoltageControl_P0Pu_
+   */
+  explicit IndexedNames(const std::string &prefix);
+
+  /**
+   * @brief Retrieve the name of the parameter of an index
+   *
+   * The reference is invalidated by the next call with a higher index
+   *
+   * @param index the index of the parameter
+   * @returns the name of the parameter
+   */
+  const std::string &operator[](unsigned int index);
+
+  /**
+   * @brief Retrieve the name of the parameters before their index
+   *
+   * @returns the prefix of the names
+   */
+  const std::string &prefix() const { return prefix_; }
+
+ private:
+  std::string prefix_;              ///< name of the parameters before their index
+  std::vector<std::string> names_;  ///< names of the parameters already built, by index
+};
+
+}  // namespace outputs
+}  // namespace dfl
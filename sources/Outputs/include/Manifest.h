@@ -0,0 +1,117 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Manifest.h
+ *
+ * @brief Dynaflow launcher outputs manifest header file
+ *
+ */
+
+#pragma once
+
+#include "Fingerprint.h"
+
+#include <boost/filesystem.hpp>
+#include <map>
+#include <string>
+
+namespace dfl {
+namespace outputs {
+
+/**
+ * @brief Manifest of the files exported in the output directory
+ *
+ * The manifest of the previous run is read from the output directory and the new manifest records the fingerprint and the status
+ * (new, changed or unchanged) of each exported file. When incremental export is on, a file whose fingerprint did not change
+ * since the previous run and which is still present on disk is not rewritten.
+ */
+class Manifest {
+ public:
+  /// @brief Status of an exported file compared to the previous run
+  enum class Status {
+    NEW = 0,   ///< file not present in the previous manifest
+    CHANGED,   ///< file fingerprint differs from the previous manifest
+    UNCHANGED  ///< file fingerprint is the same as in the previous manifest
+  };
+
+  /// @brief Constructor for a disabled manifest: every file is written and nothing is recorded
+  Manifest() = default;
+
+  /**
+   * @brief Constructor
+   *
+   * @param outputDir the output directory, containing the manifest of the previous run if any
+   * @param incremental whether the files with unchanged fingerprints are skipped
+   */
+  Manifest(const boost::filesystem::path &outputDir, bool incremental);
+
+  /**
+   * @brief Records the fingerprint of a file and determines whether it must be written
+   *
+   * @param filepath the path of the output file
+   * @param fingerprint the fingerprint of the inputs of the file
+   * @returns true if the file must be written, false if the file on disk is up to date
+   */
+  bool update(const boost::filesystem::path &filepath, const std::string &fingerprint);
+
+  /**
+   * @brief Records a file which is always written, using the fingerprint of its content
+   *
+   * @param filepath the path of the written output file
+   */
+  void updateWritten(const boost::filesystem::path &filepath);
+
+  /**
+   * @brief Retrieves the fingerprint recorded for a file during the current run
+   *
+   * @param filepath the path of the output file
+   * @returns the fingerprint of the file, empty if it was not recorded
+   */
+  std::string fingerprint(const boost::filesystem::path &filepath) const;
+
+  /**
+   * @brief Export the manifest in the output directory
+   */
+  void write() const;
+
+ private:
+  /// @brief Manifest entry for an exported file
+  struct Entry {
+    std::string fingerprint;  ///< fingerprint of the file
+    Status status;            ///< status of the file compared to the previous run
+  };
+
+  /**
+   * @brief Retrieves the key of a file in the manifest
+   *
+   * @param filepath the path of the output file
+   * @returns the path of the file relative to the output directory
+   */
+  std::string key(const boost::filesystem::path &filepath) const;
+
+  /**
+   * @brief Records a fingerprint for a file
+   *
+   * @param filepath the path of the output file
+   * @param fingerprint the fingerprint of the file
+   * @returns the status of the file compared to the previous run
+   */
+  Status record(const boost::filesystem::path &filepath, const std::string &fingerprint);
+
+  bool enabled_ = false;                                ///< whether the manifest is used
+  bool incremental_ = false;                            ///< whether the up-to-date files are skipped
+  boost::filesystem::path outputDir_;                   ///< output directory
+  std::map<std::string, std::string> previousEntries_;  ///< fingerprints of the previous run, by file
+  std::map<std::string, Entry> entries_;                ///< entries of the current run, by file
+};
+
+}  // namespace outputs
+}  // namespace dfl
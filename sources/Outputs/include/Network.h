@@ -18,6 +18,8 @@
 #pragma once
 
 #include "Configuration.h"
+
+#include <string>
 #include <PARParametersSet.h>
 
 namespace dfl {
@@ -58,6 +60,13 @@ class Network {
    */
   void write() const;
 
+  /**
+   * @brief Computes the fingerprint of the Network model parameters file inputs
+   *
+   * @returns the fingerprint
+   */
+  std::string fingerprint() const;
+
  private:
   /**
    * @brief create a new parameter set for network
@@ -82,6 +82,12 @@ static constexpr double pi_ = M_PI;                                   ///< PI va
 static constexpr double kGoverNullValue_ = 0.;                        ///< KGover null value
 static constexpr double kGoverDefaultValue_ = 1.;                     ///< KGover default value
 const std::string solverParFileName{"solver.par"};                    ///< name of the solver par file
+const std::string manifestFileName{"manifest.json"};                         ///< name of the outputs manifest file
+const std::string contingenciesArchiveFileName{"contingencies.zip"};         ///< name of the security analysis contingencies archive
+const std::string contingenciesCostsFileName{"contingenciesCosts.json"};     ///< name of the expected and measured contingencies durations file
+const std::string contingenciesHistoryFileName{"contingenciesHistory.bin"};  ///< name of the security analysis contingencies history file
+const std::string progressJournalFileName{"progressJournal.txt"};            ///< name of the security analysis progress journal file
+const std::string compilationDirectoryName{"outputs/compilation"};           ///< compilation directory of a simulation, relative to its working directory
 const std::string componentTransformerIdTag{"@TFO@"};                 ///< TFO special tag for component id
 const std::string seasonTag{"@SAISON@"};                              ///< Season special tag
 const std::string connectedStaticId{"@CONNECTED_STATIC_ID@"};         ///< Connected static id special tag
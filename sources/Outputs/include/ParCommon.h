@@ -30,7 +30,13 @@
 #include <PARReferenceFactory.h>
 #include <boost/optional.hpp>
 #include <boost/shared_ptr.hpp>
+#include <iomanip>
+#include <limits>
+#include <sstream>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace dfl {
 namespace outputs {
@@ -158,6 +164,76 @@ inline static bool generatorSharesParId(const algo::GeneratorDefinition &generat
   return parId != constants::uuid(generator.id);
 }
 
+/// @brief Alias for the mapping between a generator id and the id of the parameter set it uses
+using GeneratorParameterSetIds = std::unordered_map<std::string, std::string>;
+
+/**
+ * @brief Build the canonical key of the parameters of a generator that does not rely on a diagram file
+ *
+ * Two such generators with the same key get exactly the same parameter set content
+ *
+ * @param generator generator definition
+ * @param dynamicDataBaseManager the dynamic database manager providing the RPCL settings
+ * @return the canonical key of the generator parameters
+ */
+inline std::string getGeneratorParametersKey(const algo::GeneratorDefinition &generator, const inputs::DynamicDataBaseManager &dynamicDataBaseManager) {
+  std::ostringstream key;
+  key << std::setprecision(std::numeric_limits<double>::max_digits10);
+  key << static_cast<unsigned int>(generator.model) << '|' << DYN::doubleIsZero(generator.targetP);
+  if (generator.hasTransformer()) {
+    key << '|' << generator.isNuclear;
+  }
+  if (generator.isRegulatingRemotely()) {
+    key << '|' << generator.regulatedBusId;
+  }
+  if (generator.hasRpcl()) {
+    const auto &databaseSetting =
+        dynamicDataBaseManager.setting().getSet(dynamicDataBaseManager.assembling().getSingleAssociationFromGenerator(generator.id));
+    for (const auto &parameter : databaseSetting.doubleParameters()) {
+      key << '|' << parameter.name << '=' << parameter.value;
+    }
+  }
+  return key.str();
+}
+
+/**
+ * @brief Compute the shared parameter set ids of the generators having identical parameters
+ *
+ * Only generators with a rectangular diagram are concerned: generators with an infinite diagram already share their set by model
+ * and generators with a finite diagram reference their own diagram file.
+ * Generators with the same canonical key use the smallest of their own parameter set ids, so that the result
+ * does not depend on the order of the definitions.
+ *
+ * @param generators the generators definitions
+ * @param dynamicDataBaseManager the dynamic database manager providing the RPCL settings
+ * @return the parameter set id to use for each concerned generator
+ */
+inline GeneratorParameterSetIds computeSharedGeneratorParameterSetIds(const std::vector<algo::GeneratorDefinition> &generators,
+                                                                    const inputs::DynamicDataBaseManager &dynamicDataBaseManager) {
+  std::vector<std::pair<std::string, std::string>> generatorKeys;
+  std::unordered_map<std::string, std::string> keyToParId;
+  for (const auto &generator : generators) {
+    if (!generator.isUsingRectangularDiagram()) {
+      continue;
+    }
+    auto key = getGeneratorParametersKey(generator, dynamicDataBaseManager);
+    auto parId = constants::uuid(generator.id);
+    auto it = keyToParId.find(key);
+    if (it == keyToParId.end()) {
+      keyToParId.emplace(key, parId);
+    } else if (parId < it->second) {
+      it->second = parId;
+    }
+    generatorKeys.emplace_back(generator.id, std::move(key));
+  }
+
+  GeneratorParameterSetIds parIds;
+  for (const auto &generatorKey : generatorKeys) {
+    parIds.emplace(generatorKey.first, keyToParId.at(generatorKey.second));
+  }
+  return parIds;
+}
+
 }  // namespace helper
 
 }  // namespace outputs
@@ -20,6 +20,7 @@
 #include "DynModelDefinitionAlgorithm.h"
 #include "GeneratorDefinitionAlgorithm.h"
 #include "HVDCDefinitionAlgorithm.h"
+#include "IndexedNames.h"
 #include "LineDefinitionAlgorithm.h"
 #include "OutputsConstants.h"
 #include "ShuntDefinitionAlgorithm.h"
@@ -36,6 +37,21 @@ namespace outputs {
  */
 class ParDynModel {
  public:
+  /**
+   * @brief Names of the parameters of the secondary voltage controller models, indexed by the participants of the controllers
+   */
+  struct SVCParameterNames {
+    IndexedNames participate0{"secondaryVoltageControl_Participate0_"};  ///< whether the participant takes part in the control
+    IndexedNames qr{"secondaryVoltageControl_Qr_"};                      ///< reactive power participation of the participant
+    IndexedNames sNom{"secondaryVoltageControl_SNom_"};                  ///< nominal apparent power of the participant
+    IndexedNames p0Pu{"secondaryVoltageControl_P0Pu_"};                  ///< initial active power of the participant
+    IndexedNames q0Pu{"secondaryVoltageControl_Q0Pu_"};                  ///< initial reactive power of the participant
+    IndexedNames u0Pu{"secondaryVoltageControl_U0Pu_"};                  ///< initial voltage of the participant
+    IndexedNames xTfoPu{"secondaryVoltageControl_XTfoPu_"};              ///< reactance of the transformer of the participant
+    IndexedNames limUQUp0{"secondaryVoltageControl_limUQUp0_"};          ///< whether the participant is initially at its maximum reactive power
+    IndexedNames limUQDown0{"secondaryVoltageControl_limUQDown0_"};      ///< whether the participant is initially at its minimum reactive power
+  };
+
   /**
    * @brief Construct a new Par Dyn Model object
    *
@@ -119,6 +135,7 @@ class ParDynModel {
   const std::vector<algo::GeneratorDefinition> &generatorDefinitions_;  ///< list of generator definitions
   const algo::HVDCLineDefinitions &hvdcDefinitions_;                    ///< hvdc definitions
   std::unordered_map<std::string, size_t> generatorIdToIndex_;          ///< map of generator ids to their index
+  SVCParameterNames svcNames_;                                          ///< names of the indexed SVC parameters, shared by all the SVC sets
 };
 
 }  // namespace outputs
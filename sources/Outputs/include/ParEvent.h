@@ -63,7 +63,7 @@ class ParEvent {
     std::string basename;                                    ///< basename
     std::string filename;                                    ///< filename of the output file to write
     const inputs::Contingency &contingency;                  ///< contingency definition for the event parameters
-    const std::unordered_set<std::string> networkElements_;  ///< set of contingency elements ids using network model
+    const std::unordered_set<std::string> &networkElements_;  ///< set of contingency elements ids using network model
     double timeOfEvent;                                      ///< time of event
   };
 
@@ -79,6 +79,13 @@ class ParEvent {
    */
   void write();
 
+  /**
+   * @brief Computes the fingerprint of the PAR event file inputs
+   *
+   * @returns the fingerprint
+   */
+  std::string fingerprint() const;
+
  private:
   /**
    * @brief Build branch disconnection parameter set
@@ -130,12 +130,13 @@ class ParGenerator {
    * @brief Write generator parameter set
    *
    * @param def the generator definition to use
+   * @param parId the id of the parameter set, possibly shared with other generators having identical parameters
    * @param basename the basename for the simulation
    * @param dirname the dirname of the output directory
    *
    * @returns the parameter set
    */
-  std::shared_ptr<parameters::ParametersSet> writeGenerator(const algo::GeneratorDefinition& def, const std::string& basename,
+  std::shared_ptr<parameters::ParametersSet> writeGenerator(const algo::GeneratorDefinition& def, const std::string& parId, const std::string& basename,
                                                               const boost::filesystem::path& dirname);
 
   /**
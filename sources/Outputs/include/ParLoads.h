@@ -57,7 +57,7 @@ class ParLoads {
   std::shared_ptr<parameters::ParametersSet> writeConstantLoadsSet(dfl::inputs::Configuration::StartingPointMode startingPointMode);
 
  private:
-  std::vector<algo::LoadDefinition> loadsDefinitions_;  ///< list of loads definitions
+  const std::vector<algo::LoadDefinition>& loadsDefinitions_;  ///< list of loads definitions
 };
 
 }  // namespace outputs
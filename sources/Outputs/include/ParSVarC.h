@@ -76,7 +76,7 @@ class ParSVarC {
   }
 
  private:
-  std::vector<algo::StaticVarCompensatorDefinition> svarcsDefinitions_;  ///< list of SVarCs definitions
+  const std::vector<algo::StaticVarCompensatorDefinition>& svarcsDefinitions_;  ///< list of SVarCs definitions
   static const std::string macroParameterSetStaticCompensator_;          ///< Name of the macro parameter set for static var compensator
   static constexpr double svarcThresholdDown_ = 0.;                      ///< time threshold down for SVarC
   static constexpr double svarcThresholdUp_ = 60.;                       ///< time threshold up for SVarC
@@ -0,0 +1,81 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ProgressJournal.h
+ *
+ * @brief Dynaflow launcher security analysis progress journal header file
+ *
+ */
+
+#pragma once
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace dfl {
+namespace outputs {
+
+/**
+ * @brief Journal of the contingencies already simulated by a security analysis
+ *
+ * The journal is a text file with one tab separated line per simulated contingency, flushed as soon as the simulation is done, so that
+ * an interrupted security analysis can be resumed. A line truncated by an interrupted write is ignored.
+ */
+class ProgressJournal {
+ public:
+  /**
+   * @brief Journal entry of a simulated contingency
+   */
+  struct Entry {
+    std::string contingencyId;   ///< contingency id
+    std::string fingerprint;     ///< fingerprint of the inputs of the simulation
+    std::string status;          ///< final status of the simulation
+    double wallTime;             ///< wall time of the simulation in seconds
+    std::string resultDir;       ///< directory of the results of the simulation, relative to the output directory
+    unsigned int solverProfile;  ///< index of the solver profile of the last attempt, 0 for the default solver parameters
+  };
+
+  /**
+   * @brief Constructor
+   *
+   * @param filepath the path of the journal file
+   * @param resume whether the entries of the existing journal are kept, otherwise the journal is started over
+   */
+  ProgressJournal(const boost::filesystem::path& filepath, bool resume);
+
+  /**
+   * @brief Retrieves the entries of the existing journal
+   *
+   * @returns the last entry of each contingency, by contingency id, empty when the journal is started over
+   */
+  const std::map<std::string, Entry>& previousEntries() const { return previousEntries_; }
+
+  /**
+   * @brief Append an entry to the journal and flush it
+   *
+   * Entries can be appended concurrently
+   *
+   * @param entry the entry to append
+   */
+  void append(const Entry& entry);
+
+ private:
+  boost::filesystem::path filepath_;              ///< path of the journal file
+  std::map<std::string, Entry> previousEntries_;  ///< entries of the existing journal, by contingency id
+  std::ofstream stream_;                          ///< stream of the journal file
+  std::mutex mutex_;                              ///< mutex protecting the stream
+};
+
+}  // namespace outputs
+}  // namespace dfl
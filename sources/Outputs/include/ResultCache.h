@@ -0,0 +1,95 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ResultCache.h
+ *
+ * @brief Dynaflow launcher security analysis result cache header file
+ *
+ */
+
+#pragma once
+
+#include <boost/filesystem.hpp>
+#include <cstdint>
+#include <string>
+
+namespace dfl {
+namespace outputs {
+
+/**
+ * @brief Local disk cache of the results of the contingencies simulations, keyed by the fingerprint of their inputs
+ *
+ * Each entry is a directory named after the key, holding the outcome of the simulation and a copy of its working directory. An entry is
+ * written under a temporary name and renamed once complete, so that a partial entry is never read. The size of the cache is bounded by
+ * removing the least recently used entries.
+ */
+class ResultCache {
+ public:
+  /**
+   * @brief Outcome of a cached simulation
+   */
+  struct Result {
+    std::string status;          ///< final status of the simulation
+    double wallTime;             ///< wall time of the simulation in seconds
+    unsigned int solverProfile;  ///< index of the solver profile of the simulation, 0 for the default solver parameters
+  };
+
+  /**
+   * @brief Constructor
+   *
+   * @param directory the directory of the cache
+   * @param maxSize the maximum size of the cache in bytes
+   */
+  ResultCache(const boost::filesystem::path& directory, uint64_t maxSize);
+
+  /**
+   * @brief Restore a cached simulation
+   *
+   * The files of the cached working directory replace the content of the working directory
+   *
+   * @param key the fingerprint of the inputs of the simulation
+   * @param workingDirectory the working directory of the simulation
+   * @param result the outcome of the cached simulation
+   * @returns false if the simulation is not in the cache
+   */
+  bool restore(const std::string& key, const boost::filesystem::path& workingDirectory, Result& result) const;
+
+  /**
+   * @brief Store a simulation in the cache
+   *
+   * Simulations can be stored concurrently
+   *
+   * @param key the fingerprint of the inputs of the simulation
+   * @param workingDirectory the working directory of the simulation
+   * @param result the outcome of the simulation
+   */
+  void store(const std::string& key, const boost::filesystem::path& workingDirectory, const Result& result) const;
+
+  /**
+   * @brief Remove the least recently used entries until the cache fits in its maximum size
+   */
+  void evict() const;
+
+ private:
+  /**
+   * @brief Retrieves the directory of an entry
+   *
+   * @param key the fingerprint of the inputs of the simulation
+   * @returns the directory of the entry, which also depends on the version of the launcher
+   */
+  boost::filesystem::path entryDirectory(const std::string& key) const;
+
+  boost::filesystem::path directory_;  ///< directory of the cache
+  uint64_t maxSize_;                   ///< maximum size of the cache in bytes
+};
+
+}  // namespace outputs
+}  // namespace dfl
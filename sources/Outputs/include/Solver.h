@@ -21,6 +21,7 @@
 
 #include <PARParametersSet.h>
 #include <string>
+#include <vector>
 
 namespace dfl {
 namespace outputs {
@@ -29,6 +30,19 @@ namespace outputs {
  */
 class Solver {
  public:
+  /**
+   * @brief Statistics of the network used to tune the solver parameters
+   */
+  struct NetworkStatistics {
+    /// @brief Constructor of the statistics of an empty network
+    NetworkStatistics() : nbBuses(0), nbRegulatingGenerators(0), nbHvdcLines(0), hasSecondaryVoltageControl(false) {}
+
+    std::size_t nbBuses;                 ///< number of buses of the main connex component
+    std::size_t nbRegulatingGenerators;  ///< number of generators regulating voltage with a dynamic model
+    std::size_t nbHvdcLines;             ///< number of HVDC lines
+    bool hasSecondaryVoltageControl;     ///< whether a secondary voltage control is modelled
+  };
+
   /**
    * @brief solver par definition
    */
@@ -37,11 +51,20 @@ class Solver {
      * @brief Construct a new Solver Definition object
      *
      * @param config input configuration
+     * @param statistics statistics of the network, used when the solver auto tuning is on
      */
-    explicit SolverDefinition(const dfl::inputs::Configuration& config) : outputDir_(config.outputDir()), timeStep_(config.getTimeStep()) {}
+    explicit SolverDefinition(const dfl::inputs::Configuration& config, const NetworkStatistics& statistics = NetworkStatistics()) :
+        outputDir_(config.outputDir()),
+        timeStep_(config.getTimeStep()),
+        minTimeStep_(config.getScenarioMinTimeStep()),
+        profiles_(config.getSolverProfiles()),
+        tuning_(config.isSolverAutoTuningOn() ? autoTune(statistics, config.getStartingPointMode()) : dfl::inputs::Configuration::SolverProfile()) {}
 
-    boost::filesystem::path outputDir_;  ///< directory for output files
-    double timeStep_;                    ///< maximum value of the solver timestep
+    boost::filesystem::path outputDir_;                                ///< directory for output files
+    double timeStep_;                                                  ///< maximum value of the solver timestep
+    double minTimeStep_;                                               ///< minimum value of the solver timestep
+    std::vector<dfl::inputs::Configuration::SolverProfile> profiles_;  ///< solver profiles, each written in its own set
+    dfl::inputs::Configuration::SolverProfile tuning_;                 ///< tuned values replacing the default ones, in all the sets
   };
 
   /**
@@ -56,13 +79,46 @@ class Solver {
    */
   void write() const;
 
+  /**
+   * @brief Computes the fingerprint of the solver par file inputs
+   *
+   * @returns the fingerprint
+   */
+  std::string fingerprint() const;
+
+  /**
+   * @brief Retrieves the id of the parameter set of a solver profile
+   *
+   * @param profile the index of the profile, 0 being the default parameters and i the i-th profile of the configuration
+   * @returns the id of the parameter set
+   */
+  static std::string setId(std::size_t profile);
+
+  /**
+   * @brief Derives solver parameters from the statistics of the network
+   *
+   * The heuristic only raises the iteration limits and the number of Newton tries, so that the first attempt remains as cheap as
+   * with the default parameters when it converges:
+   * - the size class of the network (below 1000 buses, below 10000 buses, above) gives the Newton iteration limits
+   * - a flat starting point, far from the solution, doubles the iteration limit of the initial algebraic resolutions
+   * - HVDC lines, a secondary voltage control, or more than one regulating generator every 10 buses, which all imply frequent mode
+   * changes, add 5 Newton tries
+   *
+   * @param statistics the statistics of the network
+   * @param startingPointMode the starting point mode of the simulation
+   * @returns the tuned values, by parameter name
+   */
+  static dfl::inputs::Configuration::SolverProfile autoTune(const NetworkStatistics& statistics,
+                                                            dfl::inputs::Configuration::StartingPointMode startingPointMode);
+
  private:
   /**
   * @brief creates the parameter set for solver
   *
+  * @param profile the index of the profile, 0 being the default parameters
   * @return reference to the new created parameter set
   */
-  std::shared_ptr<parameters::ParametersSet> writeSolverSet() const;
+  std::shared_ptr<parameters::ParametersSet> writeSolverSet(std::size_t profile) const;
 
   SolverDefinition def_;  ///< solver par definition
 };
@@ -0,0 +1,177 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  CompilationCache.cpp
+ *
+ * @brief Dynaflow launcher cache of the compiled dynamic models implementation file
+ *
+ */
+
+#include "CompilationCache.h"
+
+#include "Fingerprint.h"
+#include "version.h"
+
+#include <algorithm>
+#include <boost/interprocess/sync/file_lock.hpp>
+#include <boost/interprocess/sync/scoped_lock.hpp>
+#include <boost/interprocess/sync/sharable_lock.hpp>
+#include <ctime>
+#include <fstream>
+#include <tuple>
+#include <vector>
+
+namespace dfl {
+namespace outputs {
+
+namespace helper {
+
+/// @brief Name of the lock file of the cache
+static const std::string lockFileName{".lock"};
+
+/**
+ * @brief Copy the files of a directory missing in another one
+ *
+ * Each file is copied under a temporary name and renamed once complete, so that a partial file is never read
+ *
+ * @param source the directory to copy
+ * @param destination the directory receiving the files
+ * @returns the number of copied files
+ */
+static std::size_t copyMissingFiles(const boost::filesystem::path& source, const boost::filesystem::path& destination) {
+  std::size_t nbFiles = 0;
+  for (const auto& entry : boost::filesystem::recursive_directory_iterator(source)) {
+    if (!boost::filesystem::is_regular_file(entry.path())) {
+      continue;
+    }
+    boost::filesystem::path target(destination);
+    target /= entry.path().lexically_relative(source);
+    if (boost::filesystem::exists(target)) {
+      continue;
+    }
+    boost::filesystem::create_directories(target.parent_path());
+    boost::filesystem::path tmpTarget(target.parent_path());
+    tmpTarget /= boost::filesystem::unique_path(".tmp-%%%%-%%%%-%%%%-%%%%");
+    try {
+      boost::filesystem::copy_file(entry.path(), tmpTarget);
+      boost::filesystem::rename(tmpTarget, target);
+    } catch (...) {
+      boost::system::error_code ec;
+      boost::filesystem::remove(tmpTarget, ec);
+      throw;
+    }
+    ++nbFiles;
+  }
+  return nbFiles;
+}
+
+/**
+ * @brief Computes the total size of the files of a directory
+ *
+ * @param directory the directory
+ * @returns the size of the files in bytes
+ */
+static uint64_t directorySize(const boost::filesystem::path& directory) {
+  uint64_t size = 0;
+  for (const auto& entry : boost::filesystem::recursive_directory_iterator(directory)) {
+    if (boost::filesystem::is_regular_file(entry.path())) {
+      size += boost::filesystem::file_size(entry.path());
+    }
+  }
+  return size;
+}
+
+}  // namespace helper
+
+CompilationCache::CompilationCache(const boost::filesystem::path& directory, uint64_t maxSize) : directory_(directory), maxSize_(maxSize) {}
+
+boost::filesystem::path CompilationCache::entryDirectory(const std::string& key) const {
+  // models compiled by another version of the launcher may not be the same
+  common::Fingerprint fingerprint;
+  fingerprint << DYNAFLOW_LAUNCHER_VERSION_STRING << key;
+  boost::filesystem::path path(directory_);
+  path /= fingerprint.str();
+  return path;
+}
+
+boost::filesystem::path CompilationCache::lockFile() const {
+  boost::filesystem::create_directories(directory_);
+  boost::filesystem::path path(directory_);
+  path /= helper::lockFileName;
+  if (!boost::filesystem::exists(path)) {
+    std::ofstream ofs(path.generic_string(), std::ios::app);
+  }
+  return path;
+}
+
+std::size_t CompilationCache::restore(const std::string& key, const boost::filesystem::path& compileDirectory) const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  boost::interprocess::file_lock fileLock(lockFile().generic_string().c_str());
+  boost::interprocess::sharable_lock<boost::interprocess::file_lock> lock(fileLock);
+
+  const auto& entryDir = entryDirectory(key);
+  if (!boost::filesystem::is_directory(entryDir)) {
+    return 0;
+  }
+  boost::filesystem::create_directories(compileDirectory);
+  std::size_t nbFiles = helper::copyMissingFiles(entryDir, compileDirectory);
+  // the modification date of the entry directory is the date of the last use of the entry
+  boost::filesystem::last_write_time(entryDir, std::time(nullptr));
+  return nbFiles;
+}
+
+std::size_t CompilationCache::store(const std::string& key, const boost::filesystem::path& compileDirectory) const {
+  if (!boost::filesystem::is_directory(compileDirectory)) {
+    return 0;
+  }
+  std::lock_guard<std::mutex> guard(mutex_);
+  boost::interprocess::file_lock fileLock(lockFile().generic_string().c_str());
+  boost::interprocess::scoped_lock<boost::interprocess::file_lock> lock(fileLock);
+
+  const auto& entryDir = entryDirectory(key);
+  boost::filesystem::create_directories(entryDir);
+  std::size_t nbFiles = helper::copyMissingFiles(compileDirectory, entryDir);
+  boost::filesystem::last_write_time(entryDir, std::time(nullptr));
+  return nbFiles;
+}
+
+void CompilationCache::evict() const {
+  if (!boost::filesystem::is_directory(directory_)) {
+    return;
+  }
+  std::lock_guard<std::mutex> guard(mutex_);
+  boost::interprocess::file_lock fileLock(lockFile().generic_string().c_str());
+  boost::interprocess::scoped_lock<boost::interprocess::file_lock> lock(fileLock);
+
+  // last use, size and directory of each entry
+  std::vector<std::tuple<std::time_t, uint64_t, boost::filesystem::path>> entries;
+  uint64_t totalSize = 0;
+  for (const auto& entry : boost::filesystem::directory_iterator(directory_)) {
+    if (!boost::filesystem::is_directory(entry.path())) {
+      continue;
+    }
+    const uint64_t size = helper::directorySize(entry.path());
+    entries.emplace_back(boost::filesystem::last_write_time(entry.path()), size, entry.path());
+    totalSize += size;
+  }
+
+  std::sort(entries.begin(), entries.end());
+  for (const auto& entry : entries) {
+    if (totalSize <= maxSize_) {
+      break;
+    }
+    boost::filesystem::remove_all(std::get<2>(entry));
+    totalSize -= std::get<1>(entry);
+  }
+}
+
+}  // namespace outputs
+}  // namespace dfl
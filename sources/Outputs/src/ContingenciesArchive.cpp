@@ -0,0 +1,477 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ContingenciesArchive.cpp
+ *
+ * @brief Dynaflow launcher security analysis contingencies archive implementation file
+ *
+ */
+
+#include "ContingenciesArchive.h"
+
+#include "Log.h"
+#include "OutputsConstants.h"
+
+#include <archive.h>
+#include <archive_entry.h>
+#include <array>
+#include <boost/optional.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+namespace dfl {
+namespace outputs {
+
+namespace helper {
+
+/// @brief Size of the chunks used to stream the files into and out of the archive
+static constexpr std::size_t chunkSize = 65536;
+
+/// @brief Name of the index entry of the archive
+static const std::string indexEntryName{"index.json"};
+
+/**
+ * @brief Aggregated output directories of the security analysis, with the prefix of their per contingency files
+ */
+static const std::vector<std::pair<std::string, std::string>> aggregatedDirectories{
+    {"timeLine", "timeline_"}, {"constraints", "constraints_"}, {"lostEquipments", "lostEquipments_"}};
+
+/**
+ * @brief Retrieves the last error of an archive
+ *
+ * @param archive the archive
+ * @returns the message of the last error of the archive
+ */
+static std::string errorString(struct archive *archive) {
+  const char *message = archive_error_string(archive);
+  return message ? message : "unknown error";
+}
+
+/**
+ * @brief Write the header of an archive entry
+ *
+ * @param archive the archive to write into
+ * @param name the name of the entry
+ * @param size the size of the data of the entry
+ */
+static void writeHeader(struct archive *archive, const std::string &name, int64_t size) {
+  struct archive_entry *entry = archive_entry_new();
+  archive_entry_set_pathname(entry, name.c_str());
+  archive_entry_set_size(entry, size);
+  archive_entry_set_filetype(entry, AE_IFREG);
+  archive_entry_set_perm(entry, 0644);
+  int status = archive_write_header(archive, entry);
+  archive_entry_free(entry);
+  if (status != ARCHIVE_OK) {
+    throw Error(SAArchiveWriteError, name, errorString(archive));
+  }
+}
+
+/**
+ * @brief Read a little-endian unsigned integer of a zip record
+ *
+ * @param data the record
+ * @param pos the position of the integer in the record
+ * @param size the size of the integer in bytes
+ * @returns the integer
+ */
+static uint64_t readLittleEndian(const std::vector<char> &data, std::size_t pos, std::size_t size) {
+  uint64_t value = 0;
+  for (std::size_t i = 0; i < size; ++i) {
+    value |= static_cast<uint64_t>(static_cast<unsigned char>(data[pos + i])) << (8 * i);
+  }
+  return value;
+}
+
+/**
+ * @brief Find the offset of an entry in a zip archive with its central directory
+ *
+ * Only archives without comment and without zip64 records are handled, which is the case of the archives written here unless they are huge
+ *
+ * @param archivePath the path of the archive
+ * @param entryName the name of the entry
+ * @returns the offset of the local header of the entry, nothing if not found
+ */
+static boost::optional<int64_t> findEntryOffset(const boost::filesystem::path &archivePath, const std::string &entryName) {
+  const std::size_t endRecordSize = 22;
+  const std::size_t centralHeaderSize = 46;
+  const uint64_t zip64Marker = 0xFFFFFFFF;
+
+  std::ifstream ifs(archivePath.generic_string(), std::ios::binary);
+  ifs.seekg(0, std::ios::end);
+  const auto archiveSize = static_cast<int64_t>(ifs.tellg());
+  if (!ifs || archiveSize < static_cast<int64_t>(endRecordSize)) {
+    return boost::none;
+  }
+  std::vector<char> endRecord(endRecordSize);
+  ifs.seekg(archiveSize - static_cast<int64_t>(endRecordSize));
+  ifs.read(endRecord.data(), endRecord.size());
+  if (!ifs || readLittleEndian(endRecord, 0, 4) != 0x06054b50) {
+    return boost::none;
+  }
+  const uint64_t directorySize = readLittleEndian(endRecord, 12, 4);
+  const uint64_t directoryOffset = readLittleEndian(endRecord, 16, 4);
+  if (directoryOffset == zip64Marker || directoryOffset + directorySize > static_cast<uint64_t>(archiveSize) - endRecordSize) {
+    return boost::none;
+  }
+
+  std::vector<char> directory(directorySize);
+  ifs.seekg(static_cast<std::streamoff>(directoryOffset));
+  ifs.read(directory.data(), directory.size());
+  if (!ifs) {
+    return boost::none;
+  }
+  std::size_t pos = 0;
+  while (pos + centralHeaderSize <= directory.size() && readLittleEndian(directory, pos, 4) == 0x02014b50) {
+    const std::size_t nameSize = readLittleEndian(directory, pos + 28, 2);
+    const std::size_t headerSize = centralHeaderSize + nameSize + readLittleEndian(directory, pos + 30, 2) + readLittleEndian(directory, pos + 32, 2);
+    if (pos + headerSize > directory.size()) {
+      return boost::none;
+    }
+    if (std::string(directory.data() + pos + centralHeaderSize, nameSize) == entryName) {
+      const uint64_t offset = readLittleEndian(directory, pos + 42, 4);
+      if (offset == zip64Marker) {
+        return boost::none;
+      }
+      return static_cast<int64_t>(offset);
+    }
+    pos += headerSize;
+  }
+  return boost::none;
+}
+
+/**
+ * @brief Archive opened for reading from an offset of its file
+ */
+class ArchiveReader {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * The entries are read from the local header at the offset, as if the archive started there
+   *
+   * @param archivePath the path of the archive
+   * @param offset the offset of the first entry to read
+   */
+  ArchiveReader(const boost::filesystem::path &archivePath, int64_t offset) : archivePath_(archivePath) {
+    file_ = fopen(archivePath.generic_string().c_str(), "rb");
+    if (file_ == NULL || fseeko(file_, static_cast<off_t>(offset), SEEK_SET) != 0) {
+      if (file_ != NULL) {
+        fclose(file_);
+      }
+      throw Error(SAArchiveReadError, archivePath.generic_string(), "cannot open the file");
+    }
+    archive_ = archive_read_new();
+    archive_read_support_format_zip(archive_);
+    if (archive_read_open_FILE(archive_, file_) != ARCHIVE_OK) {
+      std::string message = errorString(archive_);
+      archive_read_free(archive_);
+      fclose(file_);
+      throw Error(SAArchiveReadError, archivePath.generic_string(), message);
+    }
+  }
+
+  /**
+   * @brief Destructor
+   */
+  ~ArchiveReader() {
+    archive_read_free(archive_);
+    fclose(file_);
+  }
+
+  ArchiveReader(const ArchiveReader &) = delete;
+  ArchiveReader &operator=(const ArchiveReader &) = delete;
+
+  /**
+   * @brief Read the header of the next entry
+   *
+   * @returns the next entry, nullptr at the end of the archive
+   */
+  struct archive_entry *next() {
+    struct archive_entry *entry;
+    int status = archive_read_next_header(archive_, &entry);
+    if (status == ARCHIVE_EOF) {
+      return nullptr;
+    }
+    if (status != ARCHIVE_OK) {
+      throw Error(SAArchiveReadError, archivePath_.generic_string(), errorString(archive_));
+    }
+    return entry;
+  }
+
+  /**
+   * @brief Stream the data of the current entry
+   *
+   * @param os the stream to write the data into
+   */
+  void readData(std::ostream &os) {
+    std::array<char, chunkSize> buffer;
+    while (true) {
+      auto size = archive_read_data(archive_, buffer.data(), buffer.size());
+      if (size == 0) {
+        break;
+      }
+      if (size < 0) {
+        throw Error(SAArchiveReadError, archivePath_.generic_string(), errorString(archive_));
+      }
+      os.write(buffer.data(), static_cast<std::streamsize>(size));
+    }
+  }
+
+  /**
+   * @brief Skip the data of the current entry
+   */
+  void skipData() { archive_read_data_skip(archive_); }
+
+ private:
+  boost::filesystem::path archivePath_;  ///< path of the archive
+  FILE *file_;                           ///< archive file
+  struct archive *archive_;              ///< archive
+};
+
+/**
+ * @brief Determines where the files of a contingency start in an archive, using its index
+ *
+ * @param archivePath the path of the archive
+ * @param contingencyId the id of the contingency
+ * @returns the offset of the first entry of the contingency and its number of entries, nothing if the index cannot locate them
+ */
+static boost::optional<std::pair<int64_t, std::size_t>> locateContingency(const boost::filesystem::path &archivePath, const std::string &contingencyId) {
+  const auto &indexOffset = findEntryOffset(archivePath, indexEntryName);
+  if (!indexOffset) {
+    return boost::none;
+  }
+  ArchiveReader reader(archivePath, *indexOffset);
+  struct archive_entry *entry = reader.next();
+  if (entry == nullptr || archive_entry_pathname(entry) != indexEntryName) {
+    return boost::none;
+  }
+  std::stringstream indexStream;
+  reader.readData(indexStream);
+  boost::property_tree::ptree index;
+  try {
+    boost::property_tree::json_parser::read_json(indexStream, index);
+  } catch (const boost::property_tree::json_parser_error &e) {
+    throw Error(SAArchiveReadError, archivePath.generic_string(), e.what());
+  }
+  for (const auto &contingency : index.get_child("contingencies", boost::property_tree::ptree())) {
+    if (contingency.second.get<std::string>("id", "") != contingencyId) {
+      continue;
+    }
+    const auto &offset = contingency.second.get_optional<int64_t>("offset");
+    if (!offset) {
+      return boost::none;
+    }
+    return std::make_pair(*offset, contingency.second.get_child("files", boost::property_tree::ptree()).size());
+  }
+  // not in the index, so not in the archive
+  return std::make_pair(int64_t{0}, std::size_t{0});
+}
+
+/**
+ * @brief Retrieves the path of an archived file relative to the extraction directory
+ *
+ * @param name the name of the archive entry, without the contingency prefix
+ * @returns the relative path, nothing if the path is absolute or goes up the directory tree
+ */
+static boost::optional<boost::filesystem::path> safeRelativePath(const std::string &name) {
+  boost::filesystem::path path(name);
+  if (path.empty() || path.has_root_path()) {
+    return boost::none;
+  }
+  for (const auto &element : path) {
+    if (element == "..") {
+      return boost::none;
+    }
+  }
+  return path.lexically_normal();
+}
+
+}  // namespace helper
+
+ContingenciesArchive::ContingenciesArchive(ContingenciesArchiveDefinition &&def) : def_{std::move(def)} {}
+
+std::vector<boost::filesystem::path> ContingenciesArchive::listFiles(const std::string &contingencyId) const {
+  std::vector<boost::filesystem::path> files;
+  auto addIfExists = [this, &files](const boost::filesystem::path &relativePath) {
+    boost::filesystem::path path(def_.outputDir);
+    path /= relativePath;
+    if (boost::filesystem::is_regular_file(path)) {
+      files.push_back(relativePath);
+    }
+  };
+
+  // inputs of the contingency
+  for (const char *extension : {".dyd", ".par", ".jobs"}) {
+    addIfExists(def_.basename + "-" + contingencyId + extension);
+  }
+
+  // aggregated outputs of the contingency
+  for (const auto &directory : helper::aggregatedDirectories) {
+    boost::filesystem::path dir(def_.outputDir);
+    dir /= directory.first;
+    if (!boost::filesystem::is_directory(dir)) {
+      continue;
+    }
+    for (const auto &entry : boost::filesystem::directory_iterator(dir)) {
+      if (boost::filesystem::is_regular_file(entry.path()) && entry.path().stem().generic_string() == directory.second + contingencyId) {
+        files.push_back(boost::filesystem::path(directory.first) / entry.path().filename());
+      }
+    }
+  }
+
+  // working directory of the contingency
+  boost::filesystem::path contingencyDir(def_.outputDir);
+  contingencyDir /= contingencyId;
+  if (boost::filesystem::is_directory(contingencyDir)) {
+    for (const auto &entry : boost::filesystem::recursive_directory_iterator(contingencyDir)) {
+      if (boost::filesystem::is_regular_file(entry.path())) {
+        files.push_back(entry.path().lexically_relative(def_.outputDir));
+      }
+    }
+  }
+  return files;
+}
+
+void ContingenciesArchive::write() const {
+  boost::filesystem::path archivePath(def_.outputDir);
+  archivePath.append(constants::contingenciesArchiveFileName);
+  // the archive is renamed once complete so that a partial archive is never left under the final name
+  boost::filesystem::path tmpArchivePath(archivePath);
+  tmpArchivePath += ".tmp";
+
+  struct archive *archive = archive_write_new();
+  archive_write_set_format_zip(archive);
+  // the data is not blocked, so that the written bytes give the offset of each entry in the file
+  archive_write_set_bytes_per_block(archive, 0);
+  if (archive_write_open_filename(archive, tmpArchivePath.generic_string().c_str()) != ARCHIVE_OK) {
+    std::string message = helper::errorString(archive);
+    archive_write_free(archive);
+    throw Error(SAArchiveWriteError, tmpArchivePath.generic_string(), message);
+  }
+
+  boost::property_tree::ptree index;
+  boost::property_tree::ptree contingencies;
+  std::vector<boost::filesystem::path> archivedFiles;
+  std::array<char, helper::chunkSize> buffer;
+  try {
+    for (const auto &contingencyId : def_.contingencyIds) {
+      boost::property_tree::ptree contingency;
+      boost::property_tree::ptree files;
+      const int64_t offset = archive_filter_bytes(archive, -1);
+      for (const auto &file : listFiles(contingencyId)) {
+        boost::filesystem::path path(def_.outputDir);
+        path /= file;
+        const std::string &entryName = contingencyId + "/" + file.generic_string();
+        helper::writeHeader(archive, entryName, static_cast<int64_t>(boost::filesystem::file_size(path)));
+        std::ifstream ifs(path.generic_string(), std::ios::binary);
+        while (ifs) {
+          ifs.read(buffer.data(), buffer.size());
+          if (ifs.gcount() > 0 && archive_write_data(archive, buffer.data(), static_cast<size_t>(ifs.gcount())) < 0) {
+            throw Error(SAArchiveWriteError, entryName, helper::errorString(archive));
+          }
+        }
+        // the entry is completed now rather than with the next header, so that the next offset is exact
+        if (archive_write_finish_entry(archive) != ARCHIVE_OK) {
+          throw Error(SAArchiveWriteError, entryName, helper::errorString(archive));
+        }
+
+        boost::property_tree::ptree fileTree;
+        fileTree.put("", entryName);
+        files.push_back(std::make_pair("", fileTree));
+        archivedFiles.push_back(path);
+      }
+      contingency.put("id", contingencyId);
+      contingency.put("offset", offset);
+      contingency.add_child("files", files);
+      contingencies.push_back(std::make_pair("", contingency));
+    }
+
+    index.add_child("contingencies", contingencies);
+    std::stringstream indexStream;
+    boost::property_tree::json_parser::write_json(indexStream, index);
+    const std::string &indexContent = indexStream.str();
+    helper::writeHeader(archive, helper::indexEntryName, static_cast<int64_t>(indexContent.size()));
+    if (archive_write_data(archive, indexContent.data(), indexContent.size()) < 0) {
+      throw Error(SAArchiveWriteError, helper::indexEntryName, helper::errorString(archive));
+    }
+    if (archive_write_close(archive) != ARCHIVE_OK) {
+      throw Error(SAArchiveWriteError, tmpArchivePath.generic_string(), helper::errorString(archive));
+    }
+  } catch (...) {
+    archive_write_free(archive);
+    boost::filesystem::remove(tmpArchivePath);
+    throw;
+  }
+  archive_write_free(archive);
+  boost::filesystem::rename(tmpArchivePath, archivePath);
+
+  if (def_.removeFiles) {
+    for (const auto &file : archivedFiles) {
+      boost::filesystem::remove(file);
+    }
+    for (const auto &contingencyId : def_.contingencyIds) {
+      boost::filesystem::path contingencyDir(def_.outputDir);
+      contingencyDir /= contingencyId;
+      boost::filesystem::remove_all(contingencyDir);
+    }
+  }
+}
+
+std::vector<boost::filesystem::path> ContingenciesArchive::extract(const boost::filesystem::path &archivePath, const std::string &contingencyId,
+                                                                   const boost::filesystem::path &destinationDir) {
+  // the files of a contingency are contiguous in the archive: the index gives where they start, the whole archive is scanned otherwise
+  const auto &location = helper::locateContingency(archivePath, contingencyId);
+  const int64_t offset = location ? location->first : 0;
+  const std::size_t nbEntries = location ? location->second : std::numeric_limits<std::size_t>::max();
+
+  const std::string prefix = contingencyId + "/";
+  std::vector<boost::filesystem::path> extractedFiles;
+  if (nbEntries > 0) {
+    helper::ArchiveReader reader(archivePath, offset);
+    std::size_t nbReadEntries = 0;
+    struct archive_entry *entry;
+    while (nbReadEntries < nbEntries && (entry = reader.next()) != nullptr) {
+      const std::string name = archive_entry_pathname(entry);
+      if (name.compare(0, prefix.size(), prefix) != 0) {
+        reader.skipData();
+        continue;
+      }
+      ++nbReadEntries;
+      if (archive_entry_filetype(entry) == AE_IFDIR || name.back() == '/') {
+        reader.skipData();
+        continue;
+      }
+      const auto &relativePath = helper::safeRelativePath(name.substr(prefix.size()));
+      if (!relativePath) {
+        throw Error(SAArchiveInvalidEntry, name, archivePath.generic_string());
+      }
+      boost::filesystem::path path(destinationDir);
+      path /= *relativePath;
+      boost::filesystem::create_directories(path.parent_path());
+      std::ofstream ofs(path.generic_string(), std::ios::binary);
+      reader.readData(ofs);
+      extractedFiles.push_back(path);
+    }
+  }
+
+  if (extractedFiles.empty()) {
+    throw Error(SAArchiveContingencyNotFound, contingencyId, archivePath.generic_string());
+  }
+  return extractedFiles;
+}
+
+}  // namespace outputs
+}  // namespace dfl
@@ -0,0 +1,221 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ContingenciesHistory.cpp
+ *
+ * @brief Dynaflow launcher security analysis contingencies history implementation file
+ *
+ */
+
+#include "ContingenciesHistory.h"
+
+#include "Log.h"
+
+#include <boost/interprocess/sync/file_lock.hpp>
+#include <boost/interprocess/sync/scoped_lock.hpp>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+
+namespace dfl {
+namespace outputs {
+
+namespace helper {
+
+/// @brief Header of the history file, including the version of the format
+static const std::string historyHeader{"DFLHIST1"};
+
+/**
+ * @brief Append an unsigned integer in little endian
+ *
+ * @param buffer the buffer to append to
+ * @param value the value to append
+ * @param size the number of bytes of the value
+ */
+static void putUnsigned(std::string& buffer, uint64_t value, std::size_t size) {
+  for (std::size_t i = 0; i < size; ++i) {
+    buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+  }
+}
+
+/**
+ * @brief Append a string prefixed by its size
+ *
+ * @param buffer the buffer to append to
+ * @param value the string to append
+ */
+static void putString(std::string& buffer, const std::string& value) {
+  const std::size_t size = std::min<std::size_t>(value.size(), std::numeric_limits<uint16_t>::max());
+  putUnsigned(buffer, size, 2);
+  buffer.append(value, 0, size);
+}
+
+/**
+ * @brief Reader of little endian values in a buffer
+ */
+class BufferReader {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param buffer the buffer to read
+   * @param position the position of the first value to read
+   */
+  BufferReader(const std::string& buffer, std::size_t position) : buffer_(buffer), position_(position) {}
+
+  /**
+   * @brief Read an unsigned integer
+   *
+   * @param value the value read
+   * @param size the number of bytes of the value
+   * @returns false if the buffer is too short
+   */
+  bool getUnsigned(uint64_t& value, std::size_t size) {
+    if (buffer_.size() - position_ < size) {
+      return false;
+    }
+    value = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+      value |= static_cast<uint64_t>(static_cast<unsigned char>(buffer_[position_ + i])) << (8 * i);
+    }
+    position_ += size;
+    return true;
+  }
+
+  /**
+   * @brief Read a string prefixed by its size
+   *
+   * @param value the string read
+   * @returns false if the buffer is too short
+   */
+  bool getString(std::string& value) {
+    uint64_t size;
+    if (!getUnsigned(size, 2) || buffer_.size() - position_ < size) {
+      return false;
+    }
+    value = buffer_.substr(position_, size);
+    position_ += size;
+    return true;
+  }
+
+  /**
+   * @brief Retrieves the position of the next value to read
+   *
+   * @returns the position
+   */
+  std::size_t position() const { return position_; }
+
+ private:
+  const std::string& buffer_;  ///< buffer to read
+  std::size_t position_;       ///< position of the next value to read
+};
+
+/**
+ * @brief Parse the records following the header of a history
+ *
+ * @param buffer the content of the history file, starting with the header
+ * @param records the records parsed, in the order they were appended
+ * @returns the position following the last complete record
+ */
+static std::size_t parseRecords(const std::string& buffer, std::vector<ContingenciesHistory::Record>& records) {
+  BufferReader reader(buffer, historyHeader.size());
+  std::size_t end = reader.position();
+  while (reader.position() < buffer.size()) {
+    ContingenciesHistory::Record record;
+    uint64_t timestamp;
+    uint64_t wallTime;
+    if (!reader.getUnsigned(timestamp, 8) || !reader.getUnsigned(wallTime, 8) || !reader.getString(record.contingencyId) ||
+        !reader.getString(record.fingerprint) || !reader.getString(record.status)) {
+      // last record truncated by an interrupted write
+      break;
+    }
+    record.timestamp = static_cast<int64_t>(timestamp);
+    std::memcpy(&record.wallTime, &wallTime, sizeof(wallTime));
+    records.push_back(record);
+    end = reader.position();
+  }
+  return end;
+}
+
+}  // namespace helper
+
+ContingenciesHistory::ContingenciesHistory(const boost::filesystem::path& filepath) : filepath_(filepath) {}
+
+void ContingenciesHistory::append(const std::vector<Record>& records) const {
+  if (!filepath_.parent_path().empty()) {
+    boost::filesystem::create_directories(filepath_.parent_path());
+  }
+  try {
+    // the file must exist to be locked
+    std::ofstream(filepath_.generic_string(), std::ios::binary | std::ios::app);
+    boost::interprocess::file_lock fileLock(filepath_.generic_string().c_str());
+    boost::interprocess::scoped_lock<boost::interprocess::file_lock> lock(fileLock);
+
+    // A record truncated by an interrupted write is dropped, so that the appended records are not read as its end
+    std::ifstream ifs(filepath_.generic_string(), std::ios::binary);
+    const std::string content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    ifs.close();
+    std::size_t end = 0;
+    if (content.size() > helper::historyHeader.size() || content.compare(0, content.size(), helper::historyHeader, 0, content.size()) != 0) {
+      if (content.compare(0, helper::historyHeader.size(), helper::historyHeader) != 0) {
+        throw Error(SAHistoryReadError, filepath_.generic_string());
+      }
+      std::vector<Record> existing;
+      end = helper::parseRecords(content, existing);
+    }
+    if (end < content.size()) {
+      boost::filesystem::resize_file(filepath_, end);
+    }
+
+    std::string buffer;
+    if (end == 0) {
+      buffer.append(helper::historyHeader);
+    }
+    for (const auto& record : records) {
+      uint64_t wallTime;
+      static_assert(sizeof(wallTime) == sizeof(record.wallTime), "double must be 64 bits");
+      std::memcpy(&wallTime, &record.wallTime, sizeof(wallTime));
+      helper::putUnsigned(buffer, static_cast<uint64_t>(record.timestamp), 8);
+      helper::putUnsigned(buffer, wallTime, 8);
+      helper::putString(buffer, record.contingencyId);
+      helper::putString(buffer, record.fingerprint);
+      helper::putString(buffer, record.status);
+    }
+
+    std::ofstream ofs(filepath_.generic_string(), std::ios::binary | std::ios::app);
+    ofs.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    ofs.flush();
+    if (!ofs) {
+      throw Error(SAHistoryWriteError, filepath_.generic_string());
+    }
+  } catch (const boost::interprocess::interprocess_exception&) {
+    throw Error(SAHistoryWriteError, filepath_.generic_string());
+  }
+}
+
+std::vector<ContingenciesHistory::Record> ContingenciesHistory::read() const {
+  std::vector<Record> records;
+  if (!boost::filesystem::exists(filepath_)) {
+    return records;
+  }
+  std::ifstream ifs(filepath_.generic_string(), std::ios::binary);
+  const std::string buffer((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+  if (buffer.compare(0, helper::historyHeader.size(), helper::historyHeader) != 0) {
+    throw Error(SAHistoryReadError, filepath_.generic_string());
+  }
+
+  helper::parseRecords(buffer, records);
+  return records;
+}
+
+}  // namespace outputs
+}  // namespace dfl
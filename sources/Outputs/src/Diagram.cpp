@@ -25,31 +25,32 @@
 namespace dfl {
 namespace outputs {
 
-Diagram::Diagram(DiagramDefinition &&def) : def_{std::move(def)} {
-  for (auto &generator : def_.generators) {
-    std::sort(generator.points.begin(), generator.points.end(),
-              [](const DYN::GeneratorInterface::ReactiveCurvePoint &lhs, const DYN::GeneratorInterface::ReactiveCurvePoint &rhs) { return lhs.p < rhs.p; });
-  }
-  for (auto &hvdcPair : def_.hvdcDefinitions.hvdcLines) {
-    if (hvdcPair.second.vscDefinition1) {
-      auto &points = hvdcPair.second.vscDefinition1.get().points;
-      std::sort(points.begin(), points.end(),
-                [](const algo::VSCDefinition::ReactiveCurvePoint &lhs, const algo::VSCDefinition::ReactiveCurvePoint &rhs) { return lhs.p < rhs.p; });
-    }
-    if (hvdcPair.second.vscDefinition2) {
-      auto &points = hvdcPair.second.vscDefinition2.get().points;
-      std::sort(points.begin(), points.end(),
-                [](const algo::VSCDefinition::ReactiveCurvePoint &lhs, const algo::VSCDefinition::ReactiveCurvePoint &rhs) { return lhs.p < rhs.p; });
-    }
-  }
-}
+Diagram::Diagram(DiagramDefinition &&def) : def_{std::move(def)} {}
 
 void Diagram::write() const {
-  writeGenerators();
-  writeConverters();
+  Manifest manifest;
+  write(manifest);
+}
+
+void Diagram::write(Manifest &manifest) const {
+  writeGenerators(manifest);
+  writeConverters(manifest);
+}
+
+void Diagram::writeFile(const std::string &id, const std::stringstream &buffer, Manifest &manifest) const {
+  boost::filesystem::path dir(def_.directoryPath);
+  std::string filename = dir.append(outputs::constants::diagramFilename(id)).generic_string();
+  common::Fingerprint fingerprint;
+  fingerprint << buffer.str();
+  if (!manifest.update(filename, fingerprint.str())) {
+    return;
+  }
+  std::ofstream ofs(filename, std::ios::binary);
+  ofs << buffer.str();
+  ofs.close();
 }
 
-void Diagram::writeGenerators() const {
+void Diagram::writeGenerators(Manifest &manifest) const {
   for (const auto &generator : def_.generators) {
     if (!generator.isUsingDiagram() || generator.isUsingRectangularDiagram())
       continue;
@@ -63,15 +64,11 @@ void Diagram::writeGenerators() const {
 
     writeTable(generator, buffer, Tables::TABLE_QMIN);
     writeTable(generator, buffer, Tables::TABLE_QMAX);
-    boost::filesystem::path dir(def_.directoryPath);
-    std::string filename = dir.append(outputs::constants::diagramFilename(generator.id)).generic_string();
-    std::ofstream ofs(filename, std::ios::binary);
-    ofs << buffer.str();
-    ofs.close();
+    writeFile(generator.id, buffer, manifest);
   }
 }
 
-void Diagram::writeVSC(const algo::VSCDefinition &vscDefinition) const {
+void Diagram::writeVSC(const algo::VSCDefinition &vscDefinition, Manifest &manifest) const {
   if (!boost::filesystem::exists(def_.directoryPath)) {
     boost::filesystem::create_directories(def_.directoryPath);
   }
@@ -81,14 +78,10 @@ void Diagram::writeVSC(const algo::VSCDefinition &vscDefinition) const {
 
   writeTable(vscDefinition, buffer, Tables::TABLE_QMIN);
   writeTable(vscDefinition, buffer, Tables::TABLE_QMAX);
-  boost::filesystem::path dir(def_.directoryPath);
-  std::string filename = dir.append(outputs::constants::diagramFilename(vscDefinition.id)).generic_string();
-  std::ofstream ofs(filename, std::ios::binary);
-  ofs << buffer.str();
-  ofs.close();
+  writeFile(vscDefinition.id, buffer, manifest);
 }
 
-void Diagram::writeLCC(const algo::HVDCDefinition::ConverterId &converterId, double powerFactor, double pMax) const {
+void Diagram::writeLCC(const algo::HVDCDefinition::ConverterId &converterId, double powerFactor, double pMax, Manifest &manifest) const {
   if (!boost::filesystem::exists(def_.directoryPath)) {
     boost::filesystem::create_directories(def_.directoryPath);
   }
@@ -101,14 +94,10 @@ void Diagram::writeLCC(const algo::HVDCDefinition::ConverterId &converterId, dou
 
   writeTable(lccDefinition, buffer, Tables::TABLE_QMIN);
   writeTable(lccDefinition, buffer, Tables::TABLE_QMAX);
-  boost::filesystem::path dir(def_.directoryPath);
-  std::string filename = dir.append(outputs::constants::diagramFilename(converterId)).generic_string();
-  std::ofstream ofs(filename, std::ios::binary);
-  ofs << buffer.str();
-  ofs.close();
+  writeFile(converterId, buffer, manifest);
 }
 
-void Diagram::writeConverters() const {
+void Diagram::writeConverters(Manifest &manifest) const {
   for (const auto &hvdcDefPair : def_.hvdcDefinitions.hvdcLines) {
     const auto &hvdcDef = hvdcDefPair.second;
     if (!hvdcDef.hasDiagramModel()) {
@@ -120,30 +109,30 @@ void Diagram::writeConverters() const {
     switch (hvdcDef.position) {
     case algo::HVDCDefinition::Position::FIRST_IN_MAIN_COMPONENT: {
       if (hvdcDef.vscDefinition1) {
-        writeVSC(*hvdcDef.vscDefinition1);
+        writeVSC(*hvdcDef.vscDefinition1, manifest);
       } else {
-        writeLCC(hvdcDef.converter1Id, hvdcDef.powerFactors.at(0), hvdcDef.pMax);
+        writeLCC(hvdcDef.converter1Id, hvdcDef.powerFactors.at(0), hvdcDef.pMax, manifest);
       }
       break;
     }
     case algo::HVDCDefinition::Position::SECOND_IN_MAIN_COMPONENT: {
       if (hvdcDef.vscDefinition2) {
-        writeVSC(*hvdcDef.vscDefinition2);
+        writeVSC(*hvdcDef.vscDefinition2, manifest);
       } else {
-        writeLCC(hvdcDef.converter2Id, hvdcDef.powerFactors.at(1), hvdcDef.pMax);
+        writeLCC(hvdcDef.converter2Id, hvdcDef.powerFactors.at(1), hvdcDef.pMax, manifest);
       }
       break;
     }
     case algo::HVDCDefinition::Position::BOTH_IN_MAIN_COMPONENT: {
       if (hvdcDef.vscDefinition1) {
-        writeVSC(*hvdcDef.vscDefinition1);
+        writeVSC(*hvdcDef.vscDefinition1, manifest);
       } else {
-        writeLCC(hvdcDef.converter1Id, hvdcDef.powerFactors.at(0), hvdcDef.pMax);
+        writeLCC(hvdcDef.converter1Id, hvdcDef.powerFactors.at(0), hvdcDef.pMax, manifest);
       }
       if (hvdcDef.vscDefinition2) {
-        writeVSC(*hvdcDef.vscDefinition2);
+        writeVSC(*hvdcDef.vscDefinition2, manifest);
       } else {
-        writeLCC(hvdcDef.converter2Id, hvdcDef.powerFactors.at(1), hvdcDef.pMax);
+        writeLCC(hvdcDef.converter2Id, hvdcDef.powerFactors.at(1), hvdcDef.pMax, manifest);
       }
       break;
     }
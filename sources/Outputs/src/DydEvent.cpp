@@ -17,6 +17,7 @@
 
 #include "DydEvent.h"
 
+#include "Fingerprint.h"
 #include "Log.h"
 #include "OutputsConstants.h"
 
@@ -102,6 +103,15 @@ void DydEvent::write() const {
   exporter.exportToFile(dynamicModels, def_.filename, constants::xmlEncoding);
 }
 
+std::string DydEvent::fingerprint() const {
+  common::Fingerprint fingerprint;
+  fingerprint << def_.basename;
+  for (const auto &element : def_.contingency.elements) {
+    fingerprint << element.id << static_cast<int>(element.type) << isNetwork(element.id);
+  }
+  return fingerprint.str();
+}
+
 std::unique_ptr<dynamicdata::BlackBoxModel> DydEvent::buildBranchDisconnection(const std::string &branchId, const std::string &basename) {
   std::unique_ptr<dynamicdata::BlackBoxModel> model = dynamicdata::BlackBoxModelFactory::newModel("Disconnect_" + branchId);
   model->setLib("EventQuadripoleDisconnection");
@@ -49,12 +49,14 @@ const std::unordered_map<algo::GeneratorDefinition::ModelType, std::string> DydG
     std::make_pair(algo::GeneratorDefinition::ModelType::PROP_DIAGRAM_PQ_SIGNALN, "GeneratorPQPropDiagramPQSignalN")};
 
 void DydGenerator::write(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect, const std::string &basename,
-                         const std::string &slackNodeId) {
+                         const std::string &slackNodeId, const inputs::DynamicDataBaseManager &dynamicDataBaseManager) {
+  const auto sharedParIds = helper::computeSharedGeneratorParameterSetIds(generatorDefinitions_, dynamicDataBaseManager);
   for (const auto &generator : generatorDefinitions_) {
     if (generator.isNetwork()) {
       continue;
     }
-    std::string parId = helper::getGeneratorParameterSetId(generator);
+    auto sharedParIdIt = sharedParIds.find(generator.id);
+    std::string parId = sharedParIdIt != sharedParIds.end() ? sharedParIdIt->second : helper::getGeneratorParameterSetId(generator);
     std::unique_ptr<dynamicdata::BlackBoxModel> blackBoxModel =
         helper::buildBlackBoxStaticId(generator.id, generator.id, correspondence_lib_.at(generator.model), basename + ".par", parId);
     blackBoxModel->addMacroStaticRef(dynamicdata::MacroStaticRefFactory::newMacroStaticRef(macroStaticRefSignalNGeneratorName_));
@@ -0,0 +1,36 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  IndexedNames.cpp
+ *
+ * @brief Names of indexed parameters implementation file
+ *
+ */
+
+#include "IndexedNames.h"
+
+namespace dfl {
+namespace outputs {
+
+IndexedNames::IndexedNames(const std::string &prefix) : prefix_(prefix) {}
+
+const std::string &IndexedNames::operator[](unsigned int index) {
+  if (index >= names_.size()) {
+    names_.reserve(index + 1);
+    for (auto i = static_cast<unsigned int>(names_.size()); i <= index; ++i) {
+      names_.push_back(prefix_ + std::to_string(i) + "_");
+    }
+  }
+  return names_[index];
+}
+
+}  // namespace outputs
+}  // namespace dfl
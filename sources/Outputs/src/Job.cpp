@@ -17,6 +17,8 @@
 
 #include "Job.h"
 
+#include "OutputsConstants.h"
+
 #include <JOBAppenderEntry.h>
 #include <JOBAppenderEntryFactory.h>
 #include <JOBDynModelsEntry.h>
@@ -81,7 +83,7 @@ boost::shared_ptr<job::ModelerEntry> Job::writeModeler() const {
   if (def_.contingencyId) {
     modeler->setCompileDir("outputs-" + def_.contingencyId.get() + "/compilation");
   } else {
-    modeler->setCompileDir("outputs/compilation");
+    modeler->setCompileDir(constants::compilationDirectoryName);
   }
 
   auto models = job::DynModelsEntryFactory::newInstance();
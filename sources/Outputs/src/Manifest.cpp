@@ -0,0 +1,132 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Manifest.cpp
+ *
+ * @brief Dynaflow launcher outputs manifest implementation file
+ *
+ */
+
+#include "Manifest.h"
+
+#include "Log.h"
+#include "OutputsConstants.h"
+#include "version.h"
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <fstream>
+
+namespace dfl {
+namespace outputs {
+
+namespace helper {
+
+/**
+ * @brief Converts a manifest status to its string representation
+ *
+ * @param status the status to convert
+ * @returns the string representation of the status
+ */
+static std::string toString(Manifest::Status status) {
+  switch (status) {
+  case Manifest::Status::NEW:
+    return "NEW";
+  case Manifest::Status::CHANGED:
+    return "CHANGED";
+  case Manifest::Status::UNCHANGED:
+    return "UNCHANGED";
+  }
+  return "";
+}
+
+}  // namespace helper
+
+Manifest::Manifest(const boost::filesystem::path &outputDir, bool incremental) : enabled_{true}, incremental_{incremental}, outputDir_{outputDir} {
+  boost::filesystem::path manifestPath(outputDir_);
+  manifestPath.append(constants::manifestFileName);
+  if (!boost::filesystem::exists(manifestPath)) {
+    return;
+  }
+
+  try {
+    boost::property_tree::ptree tree;
+    boost::property_tree::read_json(manifestPath.generic_string(), tree);
+    // fingerprints computed by another version of the launcher may not describe the same outputs
+    if (tree.get<std::string>("version") != DYNAFLOW_LAUNCHER_VERSION_STRING) {
+      return;
+    }
+    for (const auto &file : tree.get_child("files")) {
+      previousEntries_[file.second.get<std::string>("file")] = file.second.get<std::string>("fingerprint");
+    }
+  } catch (const boost::property_tree::ptree_error &) {
+    previousEntries_.clear();
+    LOG(warn, ManifestUnreadable, manifestPath.generic_string());
+  }
+}
+
+std::string Manifest::key(const boost::filesystem::path &filepath) const { return filepath.lexically_relative(outputDir_).generic_string(); }
+
+Manifest::Status Manifest::record(const boost::filesystem::path &filepath, const std::string &fingerprint) {
+  const std::string &file = key(filepath);
+  auto found = previousEntries_.find(file);
+  Status status = Status::NEW;
+  if (found != previousEntries_.end()) {
+    status = (found->second == fingerprint) ? Status::UNCHANGED : Status::CHANGED;
+  }
+  entries_[file] = Entry{fingerprint, status};
+  return status;
+}
+
+bool Manifest::update(const boost::filesystem::path &filepath, const std::string &fingerprint) {
+  if (!enabled_) {
+    return true;
+  }
+  Status status = record(filepath, fingerprint);
+  return !incremental_ || status != Status::UNCHANGED || !boost::filesystem::exists(filepath);
+}
+
+void Manifest::updateWritten(const boost::filesystem::path &filepath) {
+  if (!enabled_) {
+    return;
+  }
+  record(filepath, common::Fingerprint::ofFile(filepath));
+}
+
+std::string Manifest::fingerprint(const boost::filesystem::path &filepath) const {
+  auto found = entries_.find(key(filepath));
+  return (found != entries_.end()) ? found->second.fingerprint : "";
+}
+
+void Manifest::write() const {
+  if (!enabled_) {
+    return;
+  }
+  boost::property_tree::ptree tree;
+  boost::property_tree::ptree files;
+  for (const auto &entry : entries_) {
+    boost::property_tree::ptree file;
+    file.put("file", entry.first);
+    file.put("fingerprint", entry.second.fingerprint);
+    file.put("status", helper::toString(entry.second.status));
+    files.push_back(std::make_pair("", file));
+  }
+  tree.put("version", DYNAFLOW_LAUNCHER_VERSION_STRING);
+  tree.add_child("files", files);
+
+  boost::filesystem::path manifestPath(outputDir_);
+  manifestPath.append(constants::manifestFileName);
+  std::ofstream ofs(manifestPath.generic_string(), std::ios::binary);
+  boost::property_tree::json_parser::write_json(ofs, tree);
+}
+
+}  // namespace outputs
+}  // namespace dfl
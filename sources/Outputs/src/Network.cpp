@@ -17,6 +17,7 @@
 
 #include "Network.h"
 
+#include "Fingerprint.h"
 #include "OutputsConstants.h"
 #include "ParCommon.h"
 
@@ -39,6 +40,13 @@ Network::write() const {
   exporter.exportToFile(paramSetCollection, networkFileName.generic_string(), constants::xmlEncoding);
 }
 
+std::string
+Network::fingerprint() const {
+  common::Fingerprint fingerprint;
+  fingerprint << static_cast<int>(def_.startingPointMode_);
+  return fingerprint.str();
+}
+
 std::shared_ptr<parameters::ParametersSet>
 Network::writeNetworkSet() const {
   // Network
@@ -61,19 +61,17 @@ std::shared_ptr<parameters::ParametersSet> ParDynModel::writeSVCParameterSet(con
   auto new_set = parameters::ParametersSetFactory::newParametersSet(set.id);
 
   std::unordered_map<std::string, unsigned> regulatorIdToInitialIndex;
-  auto itAutomaton = dynamicDataBaseManager.assembling().dynamicAutomatons().find(automaton.id);
-  assert(itAutomaton != dynamicDataBaseManager.assembling().dynamicAutomatons().end());
+  assert(dynamicDataBaseManager.assembling().dynamicAutomatons().count(automaton.id) > 0);
   unsigned regulatorIndex = 0;
-  for (const auto &macroConn : itAutomaton->second.macroConnects) {
-    if (dynamicDataBaseManager.assembling().isSingleAssociation(macroConn.id)) {
+  for (const auto *singleAssociation : dynamicDataBaseManager.assembling().getSingleAssociations(automaton.id)) {
+    if (singleAssociation) {
       bool increment = false;
-      for (const auto &gen : dynamicDataBaseManager.assembling().getSingleAssociation(macroConn.id).generators) {
+      for (const auto &gen : singleAssociation->generators) {
         regulatorIdToInitialIndex[gen.name] = regulatorIndex;
         increment = true;
       }
-      auto hvdcLine = dynamicDataBaseManager.assembling().getSingleAssociation(macroConn.id).hvdcLine;
-      if (hvdcLine) {
-        regulatorIdToInitialIndex[hvdcLine->name] = regulatorIndex;
+      if (singleAssociation->hvdcLine) {
+        regulatorIdToInitialIndex[singleAssociation->hvdcLine->name] = regulatorIndex;
         increment = true;
       }
       if (increment)
@@ -81,14 +79,9 @@ std::shared_ptr<parameters::ParametersSet> ParDynModel::writeSVCParameterSet(con
     }
   }
 
-  std::unordered_map<std::string, double> genInitialParamToValues;
-  for (const auto &param : set.doubleParameters) {
+  for (const auto &param : set.doubleParameters()) {
     if (param.name == "secondaryVoltageControl_Alpha" || param.name == "secondaryVoltageControl_Beta") {
       new_set->addParameter(helper::buildParameter(param.name, param.value));
-    } else if (param.name.find("secondaryVoltageControl_Qr_") != std::string::npos) {
-      genInitialParamToValues[param.name] = param.value;
-    } else if (param.name.find("secondaryVoltageControl_SNom_") != std::string::npos) {
-      genInitialParamToValues[param.name] = param.value;
     }
   }
 
@@ -102,67 +95,62 @@ std::shared_ptr<parameters::ParametersSet> ParDynModel::writeSVCParameterSet(con
     if (generatorIdx != generatorIdToIndex_.end()) {
       const auto &genDefinition = generatorDefinitions_[generatorIdx->second];
       if (!genDefinition.isNetwork()) {
-        new_set->addParameter(helper::buildParameter("secondaryVoltageControl_Participate0_" + std::to_string(idx) + "_", true));
+        new_set->addParameter(helper::buildParameter(svcNames_.participate0[idx], true));
       }
 
       auto it = regulatorIdToInitialIndex.find(genDefinition.id);
       if (it != regulatorIdToInitialIndex.end()) {
-        assert(genInitialParamToValues.find("secondaryVoltageControl_Qr_" + std::to_string(it->second) + "_") != genInitialParamToValues.end());
-        new_set->addParameter(helper::buildParameter("secondaryVoltageControl_Qr_" + std::to_string(idx) + "_",
-                                                     genInitialParamToValues["secondaryVoltageControl_Qr_" + std::to_string(it->second) + "_"]));
-        auto sNomIt = genInitialParamToValues.find("secondaryVoltageControl_SNom_" + std::to_string(it->second) + "_");
-        if (sNomIt != genInitialParamToValues.end()) {
-          new_set->addParameter(helper::buildParameter("secondaryVoltageControl_SNom_" + std::to_string(idx) + "_", sNomIt->second));
+        const auto &qr = set.getIndexedDoubleParameter(svcNames_.qr.prefix(), it->second);
+        assert(qr);
+        new_set->addParameter(helper::buildParameter(svcNames_.qr[idx], qr.value_or(0.)));
+        const auto &sNom = set.getIndexedDoubleParameter(svcNames_.sNom.prefix(), it->second);
+        if (sNom) {
+          new_set->addParameter(helper::buildParameter(svcNames_.sNom[idx], *sNom));
         } else {
-          new_set->addReference(helper::buildReference("secondaryVoltageControl_SNom_" + std::to_string(idx) + "_", "sNom", "DOUBLE", genDefinition.id));
+          new_set->addReference(helper::buildReference(svcNames_.sNom[idx], "sNom", "DOUBLE", genDefinition.id));
         }
       }
 
-      new_set->addReference(helper::buildReference("secondaryVoltageControl_P0Pu_" + std::to_string(idx) + "_", "p_pu", "DOUBLE", genDefinition.id));
-      new_set->addReference(helper::buildReference("secondaryVoltageControl_Q0Pu_" + std::to_string(idx) + "_", "q_pu", "DOUBLE", genDefinition.id));
-      new_set->addReference(helper::buildReference("secondaryVoltageControl_U0Pu_" + std::to_string(idx) + "_", "v_pu", "DOUBLE", genDefinition.id));
+      new_set->addReference(helper::buildReference(svcNames_.p0Pu[idx], "p_pu", "DOUBLE", genDefinition.id));
+      new_set->addReference(helper::buildReference(svcNames_.q0Pu[idx], "q_pu", "DOUBLE", genDefinition.id));
+      new_set->addReference(helper::buildReference(svcNames_.u0Pu[idx], "v_pu", "DOUBLE", genDefinition.id));
       if (genDefinition.hasTransformer())
-        new_set->addParameter(helper::buildParameter("secondaryVoltageControl_XTfoPu_" + std::to_string(idx) + "_",
-                                                     (genDefinition.isNuclear) ? constants::generatorNucXPuValue : constants::generatorXPuValue));
+        new_set->addParameter(
+            helper::buildParameter(svcNames_.xTfoPu[idx], (genDefinition.isNuclear) ? constants::generatorNucXPuValue : constants::generatorXPuValue));
 
       if (genDefinition.q < genDefinition.qmax && genDefinition.q > genDefinition.qmin) {
         frozen = false;
-        new_set->addParameter(helper::buildParameter("secondaryVoltageControl_limUQUp0_" + std::to_string(idx) + "_", false));
-        new_set->addParameter(helper::buildParameter("secondaryVoltageControl_limUQDown0_" + std::to_string(idx) + "_", false));
+        new_set->addParameter(helper::buildParameter(svcNames_.limUQUp0[idx], false));
+        new_set->addParameter(helper::buildParameter(svcNames_.limUQDown0[idx], false));
       } else {
-        new_set->addParameter(helper::buildParameter("secondaryVoltageControl_limUQUp0_" + std::to_string(idx) + "_", genDefinition.q >= genDefinition.qmax));
-        new_set->addParameter(helper::buildParameter("secondaryVoltageControl_limUQDown0_" + std::to_string(idx) + "_", genDefinition.q <= genDefinition.qmin));
+        new_set->addParameter(helper::buildParameter(svcNames_.limUQUp0[idx], genDefinition.q >= genDefinition.qmax));
+        new_set->addParameter(helper::buildParameter(svcNames_.limUQDown0[idx], genDefinition.q <= genDefinition.qmin));
       }
       ++idx;
     } else if (hvdcIt != hvdcDefinitions_.hvdcLines.end()) {
       const auto &hvdcDefinition = hvdcIt->second;
       auto it = regulatorIdToInitialIndex.find(hvdcDefinition.id);
       if (it != regulatorIdToInitialIndex.end()) {
-        assert(genInitialParamToValues.find("secondaryVoltageControl_Qr_" + std::to_string(it->second) + "_") != genInitialParamToValues.end());
-        new_set->addParameter(helper::buildParameter("secondaryVoltageControl_Qr_" + std::to_string(idx) + "_",
-                                                     genInitialParamToValues["secondaryVoltageControl_Qr_" + std::to_string(it->second) + "_"]));
+        const auto &qr = set.getIndexedDoubleParameter(svcNames_.qr.prefix(), it->second);
+        assert(qr);
+        new_set->addParameter(helper::buildParameter(svcNames_.qr[idx], qr.value_or(0.)));
       }
-      new_set->addParameter(helper::buildParameter("secondaryVoltageControl_Participate0_" + std::to_string(idx) + "_", true));
+      new_set->addParameter(helper::buildParameter(svcNames_.participate0[idx], true));
       std::string side = "1";
       if (hvdcDefinition.converterStationOnSide2())
         side = "2";
-      new_set->addReference(
-          helper::buildReference("secondaryVoltageControl_P0Pu_" + std::to_string(idx) + "_", "p" + side + "_pu", "DOUBLE", hvdcDefinition.id));
-      new_set->addReference(
-          helper::buildReference("secondaryVoltageControl_Q0Pu_" + std::to_string(idx) + "_", "q" + side + "_pu", "DOUBLE", hvdcDefinition.id));
-      new_set->addReference(
-          helper::buildReference("secondaryVoltageControl_U0Pu_" + std::to_string(idx) + "_", "v" + side + "_pu", "DOUBLE", hvdcDefinition.id));
+      new_set->addReference(helper::buildReference(svcNames_.p0Pu[idx], "p" + side + "_pu", "DOUBLE", hvdcDefinition.id));
+      new_set->addReference(helper::buildReference(svcNames_.q0Pu[idx], "q" + side + "_pu", "DOUBLE", hvdcDefinition.id));
+      new_set->addReference(helper::buildReference(svcNames_.u0Pu[idx], "v" + side + "_pu", "DOUBLE", hvdcDefinition.id));
 
       assert(hvdcDefinition.vscDefinition1);
       if (hvdcDefinition.vscDefinition1->q < hvdcDefinition.vscDefinition1->qmax && hvdcDefinition.vscDefinition1->q > hvdcDefinition.vscDefinition1->qmin) {
         frozen = false;
-        new_set->addParameter(helper::buildParameter("secondaryVoltageControl_limUQUp0_" + std::to_string(idx) + "_", false));
-        new_set->addParameter(helper::buildParameter("secondaryVoltageControl_limUQDown0_" + std::to_string(idx) + "_", false));
+        new_set->addParameter(helper::buildParameter(svcNames_.limUQUp0[idx], false));
+        new_set->addParameter(helper::buildParameter(svcNames_.limUQDown0[idx], false));
       } else {
-        new_set->addParameter(helper::buildParameter("secondaryVoltageControl_limUQUp0_" + std::to_string(idx) + "_",
-                                                     hvdcDefinition.vscDefinition1->q >= hvdcDefinition.vscDefinition1->qmax));
-        new_set->addParameter(helper::buildParameter("secondaryVoltageControl_limUQDown0_" + std::to_string(idx) + "_",
-                                                     hvdcDefinition.vscDefinition1->q <= hvdcDefinition.vscDefinition1->qmin));
+        new_set->addParameter(helper::buildParameter(svcNames_.limUQUp0[idx], hvdcDefinition.vscDefinition1->q >= hvdcDefinition.vscDefinition1->qmax));
+        new_set->addParameter(helper::buildParameter(svcNames_.limUQDown0[idx], hvdcDefinition.vscDefinition1->q <= hvdcDefinition.vscDefinition1->qmin));
       }
       ++idx;
     } else {
@@ -201,7 +189,7 @@ ParDynModel::writeDynamicModelParameterSet(const inputs::SettingDataBase::Set &s
   for (const auto &param : set.boolParameters) {
     new_set->addParameter(helper::buildParameter(param.name, param.value));
   }
-  for (const auto &param : set.doubleParameters) {
+  for (const auto &param : set.doubleParameters()) {
     new_set->addParameter(helper::buildParameter(param.name, param.value));
   }
   for (const auto &param : set.integerParameters) {
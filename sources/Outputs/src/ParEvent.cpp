@@ -18,6 +18,7 @@
 #include "ParEvent.h"
 
 #include "Contingencies.h"
+#include "Fingerprint.h"
 #include "OutputsConstants.h"
 #include "ParCommon.h"
 
@@ -61,6 +62,15 @@ void ParEvent::write() {
   exporter.exportToFile(parametersSets, def_.filename, constants::xmlEncoding);
 }
 
+std::string ParEvent::fingerprint() const {
+  common::Fingerprint fingerprint;
+  fingerprint << def_.timeOfEvent;
+  for (const auto &element : def_.contingency.elements) {
+    fingerprint << element.id << static_cast<int>(element.type) << isNetwork(element.id);
+  }
+  return fingerprint.str();
+}
+
 std::shared_ptr<parameters::ParametersSet> ParEvent::buildBranchDisconnection(const std::string &branchId, const double timeOfEvent) {
   std::shared_ptr<parameters::ParametersSet> set = parameters::ParametersSetFactory::newParametersSet("Disconnect_" + branchId);
   set->addParameter(helper::buildParameter("event_tEvent", timeOfEvent));
@@ -20,6 +20,7 @@ namespace outputs {
 void ParGenerator::write(boost::shared_ptr<parameters::ParametersSetCollection> &paramSetCollection, ActivePowerCompensation activePowerCompensation,
                          const std::string &basename, const boost::filesystem::path &dirname, StartingPointMode startingPointMode,
                          const inputs::DynamicDataBaseManager &dynamicDataBaseManager) {
+  const auto sharedParIds = helper::computeSharedGeneratorParameterSetIds(generatorDefinitions_, dynamicDataBaseManager);
   for (const auto &generator : generatorDefinitions_) {
     // if network model, nothing to do
     if (generator.isNetwork()) {
@@ -35,8 +36,17 @@ void ParGenerator::write(boost::shared_ptr<parameters::ParametersSetCollection>
       if (!paramSetCollection->hasMacroParametersSet(getGeneratorMacroParameterSetId(generator.model, DYN::doubleIsZero(generator.targetP)))) {
         paramSetCollection->addMacroParameterSet(buildGeneratorMacroParameterSet(generator, activePowerCompensation, generator.targetP, startingPointMode));
       }
+      std::string parId = constants::uuid(generator.id);
+      auto sharedParIdIt = sharedParIds.find(generator.id);
+      if (sharedParIdIt != sharedParIds.end()) {
+        if (paramSetCollection->hasParametersSet(sharedParIdIt->second)) {
+          // an identical parameter set was already written for another generator
+          continue;
+        }
+        parId = sharedParIdIt->second;
+      }
       // if generator is not using infinite diagrams, no need to create constant sets
-      paramSet = writeGenerator(generator, basename, dirname);
+      paramSet = writeGenerator(generator, parId, basename, dirname);
     }
 
     if (paramSet && generator.hasRpcl()) {
@@ -258,12 +268,12 @@ void ParGenerator::updateRemoteRegulationParameters(const algo::GeneratorDefinit
   set->addReference(helper::buildReference("generator_URegulated0", "U", "DOUBLE", def.regulatedBusId));
 }
 
-std::shared_ptr<parameters::ParametersSet> ParGenerator::writeGenerator(const algo::GeneratorDefinition &def, const std::string &basename,
-                                                                        const boost::filesystem::path &dirname) {
+std::shared_ptr<parameters::ParametersSet> ParGenerator::writeGenerator(const algo::GeneratorDefinition &def, const std::string &parId,
+                                                                        const std::string &basename, const boost::filesystem::path &dirname) {
   std::string uuid = constants::uuid(def.id);
 
   //  Use the hash id in exported files to prevent use of non-ascii characters
-  auto set = parameters::ParametersSetFactory::newParametersSet(uuid);
+  auto set = parameters::ParametersSetFactory::newParametersSet(parId);
   // The macroParSet is associated to a macroParameterSet via the id
   set->addMacroParSet(
       boost::shared_ptr<parameters::MacroParSet>(new parameters::MacroParSet(getGeneratorMacroParameterSetId(def.model, DYN::doubleIsZero(def.targetP)))));
@@ -305,19 +315,17 @@ void ParGenerator::updateRpclParameters(std::shared_ptr<parameters::ParametersSe
     parameters.push_back("reactivePowerControlLoop_TiQ");
   }
   for (auto parameter : parameters) {
-    auto paramIt = std::find_if(databaseSetting.doubleParameters.begin(), databaseSetting.doubleParameters.end(),
-                                [&parameter](const inputs::SettingDataBase::Parameter<double> &setting) { return setting.name == parameter; });
-    if (paramIt != databaseSetting.doubleParameters.end())
-      set->addParameter(helper::buildParameter(parameter, paramIt->value));
+    auto param = databaseSetting.findDoubleParameter(parameter);
+    if (param != nullptr)
+      set->addParameter(helper::buildParameter(parameter, param->value));
     else
       throw Error(MissingGeneratorHvdcParameterInSettings, parameter, genId);
   }
   std::unordered_map<std::string, std::string> parameterOrReference = {{"generator_QNomAlt", "qNom"}, {"generator_SNom", "sNom"}};
   for (auto parameter : parameterOrReference) {
-    auto paramIt = std::find_if(databaseSetting.doubleParameters.begin(), databaseSetting.doubleParameters.end(),
-                                [&parameter](const inputs::SettingDataBase::Parameter<double> &setting) { return setting.name == parameter.first; });
-    if (paramIt != databaseSetting.doubleParameters.end())
-      set->addParameter(helper::buildParameter(parameter.first, paramIt->value));
+    auto param = databaseSetting.findDoubleParameter(parameter.first);
+    if (param != nullptr)
+      set->addParameter(helper::buildParameter(parameter.first, param->value));
     else if (!set->hasParameter(parameter.first) && !set->hasReference(parameter.first))
       set->addReference(helper::buildReference(parameter.first, parameter.second, "DOUBLE"));
   }
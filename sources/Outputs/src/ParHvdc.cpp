@@ -53,16 +53,14 @@ std::shared_ptr<parameters::ParametersSet> ParHvdc::writeHdvcLine(const algo::HV
         const auto &databaseSetting =
             dynamicDataBaseManager.setting().getSet(dynamicDataBaseManager.assembling().getSingleAssociationFromHvdcLine(hvdcDefinition.id));
         std::string parameter = "hvdc_QNom";
-        auto paramIt = std::find_if(databaseSetting.doubleParameters.begin(), databaseSetting.doubleParameters.end(),
-                                    [&parameter](const inputs::SettingDataBase::Parameter<double> &setting) { return setting.name == parameter; });
-        if (paramIt != databaseSetting.doubleParameters.end()) {
-          set->addParameter(helper::buildParameter<double>("hvdc_Q" + std::to_string(parameterNumber) + "Nom", paramIt->value));
+        auto param = databaseSetting.findDoubleParameter(parameter);
+        if (param != nullptr) {
+          set->addParameter(helper::buildParameter<double>("hvdc_Q" + std::to_string(parameterNumber) + "Nom", param->value));
         }
         parameter = "hvdc_LambdaPu";
-        paramIt = std::find_if(databaseSetting.doubleParameters.begin(), databaseSetting.doubleParameters.end(),
-                               [&parameter](const inputs::SettingDataBase::Parameter<double> &setting) { return setting.name == parameter; });
-        if (paramIt != databaseSetting.doubleParameters.end()) {
-          set->addParameter(helper::buildParameter<double>("hvdc_Lambda" + std::to_string(parameterNumber) + "Pu", paramIt->value));
+        param = databaseSetting.findDoubleParameter(parameter);
+        if (param != nullptr) {
+          set->addParameter(helper::buildParameter<double>("hvdc_Lambda" + std::to_string(parameterNumber) + "Pu", param->value));
         }
       }
 
@@ -203,32 +201,29 @@ std::shared_ptr<parameters::ParametersSet> ParHvdc::writeHdvcLine(const algo::HV
     const auto &databaseSetting =
         dynamicDataBaseManager.setting().getSet(dynamicDataBaseManager.assembling().getSingleAssociationFromHvdcLine(hvdcDefinition.id));
     for (auto parameter : parameters) {
-      auto paramIt = std::find_if(databaseSetting.doubleParameters.begin(), databaseSetting.doubleParameters.end(),
-                                  [&parameter](const inputs::SettingDataBase::Parameter<double> &setting) { return setting.name == parameter; });
-      if (paramIt != databaseSetting.doubleParameters.end())
-        set->addParameter(helper::buildParameter(parameter, paramIt->value));
+      auto param = databaseSetting.findDoubleParameter(parameter);
+      if (param != nullptr)
+        set->addParameter(helper::buildParameter(parameter, param->value));
       else
         throw Error(MissingGeneratorHvdcParameterInSettings, parameter, hvdcDefinition.id);
     }
 
     // Try to use values from the setting ddb (for the case with no diagram, otherwise done in updateHVDCParams)
     std::string parameter = "hvdc_QNom";
-    auto paramIt = std::find_if(databaseSetting.doubleParameters.begin(), databaseSetting.doubleParameters.end(),
-                                [&parameter](const inputs::SettingDataBase::Parameter<double> &setting) { return setting.name == parameter; });
-    if (paramIt != databaseSetting.doubleParameters.end()) {
+    auto param = databaseSetting.findDoubleParameter(parameter);
+    if (param != nullptr) {
       if (!set->hasParameter("hvdc_Q1Nom"))
-        set->addParameter(helper::buildParameter<double>("hvdc_Q1Nom", paramIt->value));
+        set->addParameter(helper::buildParameter<double>("hvdc_Q1Nom", param->value));
       if (!set->hasParameter("hvdc_Q2Nom"))
-        set->addParameter(helper::buildParameter<double>("hvdc_Q2Nom", paramIt->value));
+        set->addParameter(helper::buildParameter<double>("hvdc_Q2Nom", param->value));
     }
     parameter = "hvdc_LambdaPu";
-    paramIt = std::find_if(databaseSetting.doubleParameters.begin(), databaseSetting.doubleParameters.end(),
-                           [&parameter](const inputs::SettingDataBase::Parameter<double> &setting) { return setting.name == parameter; });
-    if (paramIt != databaseSetting.doubleParameters.end()) {
+    param = databaseSetting.findDoubleParameter(parameter);
+    if (param != nullptr) {
       if (!set->hasParameter("hvdc_Lambda1Pu"))
-        set->addParameter(helper::buildParameter<double>("hvdc_Lambda1Pu", paramIt->value));
+        set->addParameter(helper::buildParameter<double>("hvdc_Lambda1Pu", param->value));
       if (!set->hasParameter("hvdc_Lambda2Pu"))
-        set->addParameter(helper::buildParameter<double>("hvdc_Lambda2Pu", paramIt->value));
+        set->addParameter(helper::buildParameter<double>("hvdc_Lambda2Pu", param->value));
     }
   }
   if (!hvdcDefinition.hasDiagramModel() && hvdcDefinition.converterType == dfl::inputs::HvdcLine::ConverterType::VSC) {
@@ -287,10 +282,9 @@ std::shared_ptr<parameters::ParametersSet> ParHvdc::writeHdvcLine(const algo::HV
     } else {
       const auto &databaseSetting =
           dynamicDataBaseManager.setting().getSet(dynamicDataBaseManager.assembling().getSingleAssociationFromHvdcLine(hvdcDefinition.id));
-      auto paramIt = std::find_if(databaseSetting.doubleParameters.begin(), databaseSetting.doubleParameters.end(),
-                                  [&parameter](const inputs::SettingDataBase::Parameter<double> &setting) { return setting.name == parameter; });
-      if (paramIt != databaseSetting.doubleParameters.end())
-        set->addParameter(helper::buildParameter(parameter, paramIt->value));
+      auto param = databaseSetting.findDoubleParameter(parameter);
+      if (param != nullptr)
+        set->addParameter(helper::buildParameter(parameter, param->value));
       else
         set->addParameter(helper::buildParameter(parameter, constants::hvdcACEmulationTFilterDefaultValue));
     }
@@ -0,0 +1,108 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ProgressJournal.cpp
+ *
+ * @brief Dynaflow launcher security analysis progress journal implementation file
+ *
+ */
+
+#include "ProgressJournal.h"
+
+#include "Log.h"
+
+#include <boost/algorithm/string/split.hpp>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+namespace dfl {
+namespace outputs {
+
+namespace helper {
+
+/// @brief Separator of the fields of a journal line
+static constexpr char separator = '\t';
+
+/// @brief Number of fields of a journal line
+static constexpr std::size_t nbFields = 6;
+
+/// @brief Number of fields of a journal line written before the solver profiles were recorded
+static constexpr std::size_t nbFieldsWithoutSolverProfile = 5;
+
+}  // namespace helper
+
+ProgressJournal::ProgressJournal(const boost::filesystem::path& filepath, bool resume) : filepath_(filepath) {
+  bool completeLastLine = true;
+  if (resume && boost::filesystem::exists(filepath_)) {
+    std::ifstream ifs(filepath_.generic_string(), std::ios::binary);
+    std::string line;
+    while (std::getline(ifs, line)) {
+      if (ifs.eof()) {
+        // last line truncated by an interrupted write
+        completeLastLine = false;
+        break;
+      }
+      std::vector<std::string> fields;
+      boost::algorithm::split(fields, line, [](char c) { return c == helper::separator; });
+      if (fields.size() != helper::nbFields && fields.size() != helper::nbFieldsWithoutSolverProfile) {
+        continue;
+      }
+      Entry entry;
+      entry.contingencyId = fields[0];
+      entry.fingerprint = fields[1];
+      entry.status = fields[2];
+      std::istringstream wallTime(fields[3]);
+      if (!(wallTime >> entry.wallTime)) {
+        continue;
+      }
+      entry.resultDir = fields[4];
+      entry.solverProfile = 0;
+      if (fields.size() == helper::nbFields) {
+        std::istringstream solverProfile(fields[5]);
+        if (!(solverProfile >> entry.solverProfile)) {
+          continue;
+        }
+      }
+      previousEntries_[entry.contingencyId] = entry;
+    }
+  }
+
+  if (!filepath_.parent_path().empty()) {
+    boost::filesystem::create_directories(filepath_.parent_path());
+  }
+  stream_.open(filepath_.generic_string(), resume ? (std::ios::binary | std::ios::app) : (std::ios::binary | std::ios::trunc));
+  if (!stream_) {
+    throw Error(SAJournalWriteError, filepath_.generic_string());
+  }
+  if (!completeLastLine) {
+    // the next entry must not be appended to the truncated line
+    stream_ << std::endl;
+  }
+}
+
+void ProgressJournal::append(const Entry& entry) {
+  std::ostringstream line;
+  line << std::setprecision(std::numeric_limits<double>::max_digits10) << entry.contingencyId << helper::separator << entry.fingerprint
+       << helper::separator << entry.status << helper::separator << entry.wallTime << helper::separator << entry.resultDir << helper::separator
+       << entry.solverProfile << '\n';
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  stream_ << line.str();
+  stream_.flush();
+  if (!stream_) {
+    throw Error(SAJournalWriteError, filepath_.generic_string());
+  }
+}
+
+}  // namespace outputs
+}  // namespace dfl
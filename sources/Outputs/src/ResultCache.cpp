@@ -0,0 +1,163 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ResultCache.cpp
+ *
+ * @brief Dynaflow launcher security analysis result cache implementation file
+ *
+ */
+
+#include "ResultCache.h"
+
+#include "Fingerprint.h"
+#include "version.h"
+
+#include <algorithm>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <ctime>
+#include <tuple>
+#include <vector>
+
+namespace dfl {
+namespace outputs {
+
+namespace helper {
+
+/// @brief Name of the file describing an entry
+static const std::string entryFileName{"entry.json"};
+
+/// @brief Name of the directory holding the copy of the working directory of an entry
+static const std::string filesDirectoryName{"files"};
+
+/**
+ * @brief Copy the files of a directory into another one, which must not contain them already
+ *
+ * @param source the directory to copy
+ * @param destination the directory receiving the files
+ * @returns the total size of the copied files in bytes
+ */
+static uint64_t copyFiles(const boost::filesystem::path& source, const boost::filesystem::path& destination) {
+  uint64_t size = 0;
+  boost::filesystem::create_directories(destination);
+  for (const auto& entry : boost::filesystem::recursive_directory_iterator(source)) {
+    boost::filesystem::path target(destination);
+    target /= entry.path().lexically_relative(source);
+    if (boost::filesystem::is_directory(entry.path())) {
+      boost::filesystem::create_directories(target);
+    } else if (boost::filesystem::is_regular_file(entry.path())) {
+      boost::filesystem::copy_file(entry.path(), target);
+      size += boost::filesystem::file_size(entry.path());
+    }
+  }
+  return size;
+}
+
+}  // namespace helper
+
+ResultCache::ResultCache(const boost::filesystem::path& directory, uint64_t maxSize) : directory_(directory), maxSize_(maxSize) {}
+
+boost::filesystem::path ResultCache::entryDirectory(const std::string& key) const {
+  // results of another version of the launcher may not be the same
+  common::Fingerprint fingerprint;
+  fingerprint << DYNAFLOW_LAUNCHER_VERSION_STRING << key;
+  boost::filesystem::path path(directory_);
+  path /= fingerprint.str();
+  return path;
+}
+
+bool ResultCache::restore(const std::string& key, const boost::filesystem::path& workingDirectory, Result& result) const {
+  const auto& entryDir = entryDirectory(key);
+  const auto& entryFile = entryDir / helper::entryFileName;
+  if (!boost::filesystem::exists(entryFile)) {
+    return false;
+  }
+  boost::property_tree::ptree tree;
+  boost::property_tree::read_json(entryFile.generic_string(), tree);
+  result.status = tree.get<std::string>("status");
+  result.wallTime = tree.get<double>("wallTime");
+  result.solverProfile = tree.get<unsigned int>("solverProfile", 0);
+
+  boost::filesystem::remove_all(workingDirectory);
+  helper::copyFiles(entryDir / helper::filesDirectoryName, workingDirectory);
+  // the modification date of the entry file is the date of the last use of the entry
+  boost::filesystem::last_write_time(entryFile, std::time(nullptr));
+  return true;
+}
+
+void ResultCache::store(const std::string& key, const boost::filesystem::path& workingDirectory, const Result& result) const {
+  const auto& entryDir = entryDirectory(key);
+  if (boost::filesystem::exists(entryDir)) {
+    return;
+  }
+  boost::filesystem::path tmpEntryDir(directory_);
+  tmpEntryDir /= boost::filesystem::unique_path(".tmp-%%%%-%%%%-%%%%-%%%%");
+  try {
+    uint64_t size = 0;
+    if (boost::filesystem::is_directory(workingDirectory)) {
+      size = helper::copyFiles(workingDirectory, tmpEntryDir / helper::filesDirectoryName);
+    } else {
+      boost::filesystem::create_directories(tmpEntryDir / helper::filesDirectoryName);
+    }
+    boost::property_tree::ptree tree;
+    tree.put("status", result.status);
+    tree.put("wallTime", result.wallTime);
+    tree.put("solverProfile", result.solverProfile);
+    tree.put("size", size);
+    boost::property_tree::json_parser::write_json((tmpEntryDir / helper::entryFileName).generic_string(), tree);
+    boost::filesystem::rename(tmpEntryDir, entryDir);
+  } catch (...) {
+    boost::system::error_code ec;
+    boost::filesystem::remove_all(tmpEntryDir, ec);
+    if (!boost::filesystem::exists(entryDir)) {
+      throw;
+    }
+    // the same entry was stored concurrently
+  }
+}
+
+void ResultCache::evict() const {
+  if (!boost::filesystem::is_directory(directory_)) {
+    return;
+  }
+  // last use, size and directory of each entry
+  std::vector<std::tuple<std::time_t, uint64_t, boost::filesystem::path>> entries;
+  uint64_t totalSize = 0;
+  for (const auto& entry : boost::filesystem::directory_iterator(directory_)) {
+    if (!boost::filesystem::is_directory(entry.path()) || entry.path().filename().generic_string().front() == '.') {
+      continue;
+    }
+    const auto& entryFile = entry.path() / helper::entryFileName;
+    try {
+      boost::property_tree::ptree tree;
+      boost::property_tree::read_json(entryFile.generic_string(), tree);
+      const uint64_t size = tree.get<uint64_t>("size");
+      entries.emplace_back(boost::filesystem::last_write_time(entryFile), size, entry.path());
+      totalSize += size;
+    } catch (const std::exception&) {
+      // unreadable entries are never restored
+      boost::system::error_code ec;
+      boost::filesystem::remove_all(entry.path(), ec);
+    }
+  }
+
+  std::sort(entries.begin(), entries.end());
+  for (const auto& entry : entries) {
+    if (totalSize <= maxSize_) {
+      break;
+    }
+    boost::filesystem::remove_all(std::get<2>(entry));
+    totalSize -= std::get<1>(entry);
+  }
+}
+
+}  // namespace outputs
+}  // namespace dfl
@@ -17,55 +17,151 @@
 
 #include "Solver.h"
 
+#include "Fingerprint.h"
+#include "Log.h"
 #include "ParCommon.h"
 
 #include <PARParametersSetCollection.h>
 #include <PARParametersSetCollectionFactory.h>
 #include <PARXmlExporter.h>
+#include <set>
 
 namespace dfl {
 namespace outputs {
 
+namespace helper {
+
+/**
+ * @brief Solver parameters of a size class of networks
+ */
+struct SizeClassTuning {
+  std::size_t minNbBuses;  ///< minimum number of buses of the class
+  int mxiter;              ///< maximum number of Newton iterations of the time steps
+  int mxiterAlg;           ///< maximum number of Newton iterations of the algebraic resolutions
+  int mxiterAlgJ;          ///< maximum number of Newton iterations of the algebraic resolutions with a Jacobian update at each iteration
+  int maxNewtonTry;        ///< maximum number of Newton tries before a time step reduction
+};
+
+/// @brief Solver parameters by size class of networks, in increasing order of size, the first class having the default values
+static const std::vector<SizeClassTuning> sizeClassTunings{{0, 15, 30, 50, 10}, {1000, 20, 40, 75, 15}, {10000, 25, 50, 100, 20}};
+
+/// @brief Number of regulating generators per bus above which the mode changes of the generators are frequent
+static constexpr double regulatingGeneratorsDensity = 0.1;
+
+/// @brief Number of Newton tries added for a network with frequent mode changes
+static constexpr int modeChangesNewtonTries = 5;
+
+}  // namespace helper
+
 Solver::Solver(SolverDefinition &&def) : def_{std::move(def)} {}
 
 void Solver::write() const {
   parameters::XmlExporter exporter;
   auto paramSetCollection = parameters::ParametersSetCollectionFactory::newCollection();
-  paramSetCollection->addParametersSet(writeSolverSet());
+  for (std::size_t profile = 0; profile <= def_.profiles_.size(); ++profile) {
+    paramSetCollection->addParametersSet(writeSolverSet(profile));
+  }
   boost::filesystem::path solverFileName(def_.outputDir_);
   solverFileName.append(constants::solverParFileName);
   exporter.exportToFile(paramSetCollection, solverFileName.generic_string(), constants::xmlEncoding);
 }
 
-std::shared_ptr<parameters::ParametersSet> Solver::writeSolverSet() const {
-  auto set = parameters::ParametersSetFactory::newParametersSet("SimplifiedSolver");
-  set->addParameter(helper::buildParameter("fnormtol", 1e-4));
-  set->addParameter(helper::buildParameter("fnormtolAlg", 1e-4));
-  set->addParameter(helper::buildParameter("fnormtolAlgJ", 1e-4));
-  set->addParameter(helper::buildParameter("hMax", def_.timeStep_));
-  set->addParameter(helper::buildParameter("hMin", 1.));
-  set->addParameter(helper::buildParameter("initialaddtol", 0.1));
-  set->addParameter(helper::buildParameter("initialaddtolAlg", 0.1));
-  set->addParameter(helper::buildParameter("initialaddtolAlgJ", 0.1));
-  set->addParameter(helper::buildParameter("kReduceStep", 0.5));
-  set->addParameter(helper::buildParameter("maxNewtonTry", 10));
-  set->addParameter(helper::buildParameter("msbset", 0));
-  set->addParameter(helper::buildParameter("msbsetAlg", 1));
-  set->addParameter(helper::buildParameter("msbsetAlgJ", 1));
-  set->addParameter(helper::buildParameter("mxiter", 15));
-  set->addParameter(helper::buildParameter("mxiterAlg", 30));
-  set->addParameter(helper::buildParameter("mxiterAlgJ", 50));
-  set->addParameter(helper::buildParameter("mxnewtstep", 100000.));
-  set->addParameter(helper::buildParameter("mxnewtstepAlg", 100000.));
-  set->addParameter(helper::buildParameter("mxnewtstepAlgJ", 100000.));
+std::string Solver::fingerprint() const {
+  common::Fingerprint fingerprint;
+  fingerprint << def_.timeStep_ << def_.minTimeStep_ << def_.tuning_.size();
+  for (const auto &parameter : def_.tuning_) {
+    fingerprint << parameter.first << parameter.second;
+  }
+  for (const auto &profile : def_.profiles_) {
+    fingerprint << profile.size();
+    for (const auto &parameter : profile) {
+      fingerprint << parameter.first << parameter.second;
+    }
+  }
+  return fingerprint.str();
+}
+
+std::string Solver::setId(std::size_t profile) {
+  static const std::string defaultSetId{"SimplifiedSolver"};
+  return (profile == 0) ? defaultSetId : defaultSetId + "_" + std::to_string(profile);
+}
+
+dfl::inputs::Configuration::SolverProfile Solver::autoTune(const NetworkStatistics &statistics,
+                                                          dfl::inputs::Configuration::StartingPointMode startingPointMode) {
+  auto sizeClass = helper::sizeClassTunings.begin();
+  for (auto it = helper::sizeClassTunings.begin(); it != helper::sizeClassTunings.end(); ++it) {
+    if (statistics.nbBuses >= it->minNbBuses) {
+      sizeClass = it;
+    }
+  }
+
+  int mxiterAlgJ = sizeClass->mxiterAlgJ;
+  if (startingPointMode == dfl::inputs::Configuration::StartingPointMode::FLAT) {
+    mxiterAlgJ *= 2;
+  }
+  int maxNewtonTry = sizeClass->maxNewtonTry;
+  if (statistics.nbHvdcLines > 0 || statistics.hasSecondaryVoltageControl ||
+      statistics.nbRegulatingGenerators > helper::regulatingGeneratorsDensity * statistics.nbBuses) {
+    maxNewtonTry += helper::modeChangesNewtonTries;
+  }
+
+  dfl::inputs::Configuration::SolverProfile tuning;
+  tuning["mxiter"] = sizeClass->mxiter;
+  tuning["mxiterAlg"] = sizeClass->mxiterAlg;
+  tuning["mxiterAlgJ"] = mxiterAlgJ;
+  tuning["maxNewtonTry"] = maxNewtonTry;
+  return tuning;
+}
+
+std::shared_ptr<parameters::ParametersSet> Solver::writeSolverSet(std::size_t profile) const {
+  static const dfl::inputs::Configuration::SolverProfile defaultProfile;
+  const auto &overrides = (profile == 0) ? defaultProfile : def_.profiles_[profile - 1];
+  std::set<std::string> overridden;
+  // value of a numeric parameter, overridden by the profile if defined in it, or else by the tuned values
+  auto value = [this, &overrides, &overridden](const std::string &name, double defaultValue) {
+    auto found = overrides.find(name);
+    if (found == overrides.end()) {
+      auto tuned = def_.tuning_.find(name);
+      return (tuned != def_.tuning_.end()) ? tuned->second : defaultValue;
+    }
+    overridden.insert(name);
+    return found->second;
+  };
+
+  auto set = parameters::ParametersSetFactory::newParametersSet(setId(profile));
+  set->addParameter(helper::buildParameter("fnormtol", value("fnormtol", 1e-4)));
+  set->addParameter(helper::buildParameter("fnormtolAlg", value("fnormtolAlg", 1e-4)));
+  set->addParameter(helper::buildParameter("fnormtolAlgJ", value("fnormtolAlgJ", 1e-4)));
+  set->addParameter(helper::buildParameter("hMax", value("hMax", def_.timeStep_)));
+  set->addParameter(helper::buildParameter("hMin", value("hMin", def_.minTimeStep_)));
+  set->addParameter(helper::buildParameter("initialaddtol", value("initialaddtol", 0.1)));
+  set->addParameter(helper::buildParameter("initialaddtolAlg", value("initialaddtolAlg", 0.1)));
+  set->addParameter(helper::buildParameter("initialaddtolAlgJ", value("initialaddtolAlgJ", 0.1)));
+  set->addParameter(helper::buildParameter("kReduceStep", value("kReduceStep", 0.5)));
+  set->addParameter(helper::buildParameter("maxNewtonTry", static_cast<int>(value("maxNewtonTry", 10))));
+  set->addParameter(helper::buildParameter("msbset", static_cast<int>(value("msbset", 0))));
+  set->addParameter(helper::buildParameter("msbsetAlg", static_cast<int>(value("msbsetAlg", 1))));
+  set->addParameter(helper::buildParameter("msbsetAlgJ", static_cast<int>(value("msbsetAlgJ", 1))));
+  set->addParameter(helper::buildParameter("mxiter", static_cast<int>(value("mxiter", 15))));
+  set->addParameter(helper::buildParameter("mxiterAlg", static_cast<int>(value("mxiterAlg", 30))));
+  set->addParameter(helper::buildParameter("mxiterAlgJ", static_cast<int>(value("mxiterAlgJ", 50))));
+  set->addParameter(helper::buildParameter("mxnewtstep", value("mxnewtstep", 100000.)));
+  set->addParameter(helper::buildParameter("mxnewtstepAlg", value("mxnewtstepAlg", 100000.)));
+  set->addParameter(helper::buildParameter("mxnewtstepAlgJ", value("mxnewtstepAlgJ", 100000.)));
   set->addParameter(helper::buildParameter("printfl", 0));
   set->addParameter(helper::buildParameter("printflAlg", 0));
   set->addParameter(helper::buildParameter("printflAlgJ", 0));
-  set->addParameter(helper::buildParameter("scsteptol", 1.e-4));
-  set->addParameter(helper::buildParameter("scsteptolAlg", 1.e-4));
-  set->addParameter(helper::buildParameter("scsteptolAlgJ", 1.e-4));
+  set->addParameter(helper::buildParameter("scsteptol", value("scsteptol", 1.e-4)));
+  set->addParameter(helper::buildParameter("scsteptolAlg", value("scsteptolAlg", 1.e-4)));
+  set->addParameter(helper::buildParameter("scsteptolAlgJ", value("scsteptolAlgJ", 1.e-4)));
   set->addParameter(helper::buildParameter("minimumModeChangeTypeForAlgebraicRestoration", std::string("ALGEBRAIC_J_UPDATE")));
   set->addParameter(helper::buildParameter("minimumModeChangeTypeForAlgebraicRestorationInit", std::string("ALGEBRAIC_J_UPDATE")));
+
+  for (const auto &parameter : overrides) {
+    if (overridden.count(parameter.first) == 0) {
+      throw Error(SolverProfileUnknownParameter, parameter.first, profile);
+    }
+  }
   return set;
 }
 
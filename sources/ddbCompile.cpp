@@ -0,0 +1,57 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+
+/**
+ * @file  ddbCompile.cpp
+ *
+ * @brief Compiles the setting and assembling files of a dynamic database into its binary file
+ *
+ */
+
+#include "DynamicDataBaseBinary.h"
+#include "Log.h"
+
+#include <DYNError.h>
+#include <boost/filesystem.hpp>
+#include <cstdlib>
+#include <iostream>
+
+int main(int argc, char *argv[]) {
+  if (argc != 3) {
+    std::cerr << "Usage: " << argv[0] << " <setting file> <assembling file>" << std::endl;
+    std::cerr << "One of the files may be given as an empty string" << std::endl;
+    return EXIT_FAILURE;
+  }
+  boost::filesystem::path settingFilePath(argv[1]);
+  boost::filesystem::path assemblingFilePath(argv[2]);
+  const auto &binaryFilePath = dfl::inputs::DynamicDataBaseBinary::binaryPath(settingFilePath, assemblingFilePath);
+  if (binaryFilePath.empty()) {
+    std::cerr << "Compilation failed: no setting nor assembling file given" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  try {
+    dfl::common::Log::initDictionaries();
+    // the XML files are always parsed, even if the binary file is up to date
+    dfl::inputs::SettingDataBase setting(settingFilePath);
+    dfl::inputs::AssemblingDataBase assembling(assemblingFilePath);
+    dfl::inputs::DynamicDataBaseBinary::write(binaryFilePath, settingFilePath, assemblingFilePath, setting, assembling);
+    std::cout << binaryFilePath.generic_string() << std::endl;
+  } catch (DYN::Error &e) {
+    std::cerr << "Compilation failed: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (DYN::MessageError &e) {
+    std::cerr << "Compilation failed: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (std::exception &e) {
+    std::cerr << "Compilation failed: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -61,7 +61,8 @@ static boost::shared_ptr<dfl::Context> buildContext(dfl::inputs::SimulationParam
                                params.runtimeConfig->contingenciesFilePath,
                                params.runtimeConfig->dynawoLogLevel,
                                params.resourcesDirPath,
-                               params.locale};
+                               params.locale,
+                               params.runtimeConfig->resume};
 
   boost::shared_ptr<dfl::Context> context = boost::shared_ptr<dfl::Context>(new dfl::Context(def, config));
 
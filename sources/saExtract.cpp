@@ -0,0 +1,48 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+
+/**
+ * @file  saExtract.cpp
+ *
+ * @brief Extracts the files of a single contingency from a security analysis archive
+ *
+ */
+
+#include "ContingenciesArchive.h"
+#include "Log.h"
+
+#include <DYNError.h>
+#include <boost/filesystem.hpp>
+#include <cstdlib>
+#include <iostream>
+
+int main(int argc, char *argv[]) {
+  if (argc != 3 && argc != 4) {
+    std::cerr << "Usage: " << argv[0] << " <archive> <contingency id> [destination directory]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  boost::filesystem::path destinationDir = argc == 4 ? boost::filesystem::path(argv[3]) : boost::filesystem::current_path();
+
+  try {
+    dfl::common::Log::initDictionaries();
+    for (const auto &file : dfl::outputs::ContingenciesArchive::extract(argv[1], argv[2], destinationDir)) {
+      std::cout << file.generic_string() << std::endl;
+    }
+  } catch (DYN::Error &e) {
+    std::cerr << "Extraction failed: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (DYN::MessageError &e) {
+    std::cerr << "Extraction failed: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (std::exception &e) {
+    std::cerr << "Extraction failed: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,123 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+
+/**
+ * @file  saHistory.cpp
+ *
+ * @brief Prints the history of the contingencies of the successive security analyses
+ *
+ */
+
+#include "ContingenciesHistory.h"
+#include "Log.h"
+
+#include <DYNError.h>
+#include <boost/filesystem.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+
+/**
+ * @brief Summary of the history of a contingency
+ */
+struct Summary {
+  unsigned int nbRuns = 0;                                ///< number of recorded runs
+  unsigned int nbFailures = 0;                            ///< number of runs whose status is not CONVERGENCE
+  unsigned int nbMeasured = 0;                            ///< number of runs whose wall time was measured
+  double totalWallTime = 0.;                              ///< sum of the measured wall times
+  dfl::outputs::ContingenciesHistory::Record lastRecord;  ///< last recorded run
+};
+
+/**
+ * @brief Print every recorded run of a contingency
+ *
+ * @param records the records of the history
+ * @param contingencyId the id of the contingency
+ * @returns false if the contingency is not in the history
+ */
+static bool printContingency(const std::vector<dfl::outputs::ContingenciesHistory::Record> &records, const std::string &contingencyId) {
+  bool found = false;
+  std::cout << "timestamp\tfingerprint\tstatus\twallTime" << std::endl;
+  for (const auto &record : records) {
+    if (record.contingencyId != contingencyId) {
+      continue;
+    }
+    found = true;
+    std::cout << record.timestamp << "\t" << record.fingerprint << "\t" << record.status << "\t";
+    if (record.wallTime >= 0.) {
+      std::cout << record.wallTime;
+    } else {
+      std::cout << "-";
+    }
+    std::cout << std::endl;
+  }
+  return found;
+}
+
+/**
+ * @brief Print the summary of the history of every contingency
+ *
+ * @param records the records of the history
+ */
+static void printSummaries(const std::vector<dfl::outputs::ContingenciesHistory::Record> &records) {
+  std::map<std::string, Summary> summaries;
+  for (const auto &record : records) {
+    Summary &summary = summaries[record.contingencyId];
+    ++summary.nbRuns;
+    if (record.status != "CONVERGENCE") {
+      ++summary.nbFailures;
+    }
+    if (record.wallTime >= 0.) {
+      ++summary.nbMeasured;
+      summary.totalWallTime += record.wallTime;
+    }
+    summary.lastRecord = record;
+  }
+
+  std::cout << "contingency\truns\tfailures\tmeanWallTime\tlastStatus\tlastFingerprint" << std::endl;
+  for (const auto &summary : summaries) {
+    std::cout << summary.first << "\t" << summary.second.nbRuns << "\t" << summary.second.nbFailures << "\t";
+    if (summary.second.nbMeasured > 0) {
+      std::cout << summary.second.totalWallTime / summary.second.nbMeasured;
+    } else {
+      std::cout << "-";
+    }
+    std::cout << "\t" << summary.second.lastRecord.status << "\t" << summary.second.lastRecord.fingerprint << std::endl;
+  }
+}
+
+int main(int argc, char *argv[]) {
+  if (argc != 2 && argc != 3) {
+    std::cerr << "Usage: " << argv[0] << " <history file> [contingency id]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  try {
+    dfl::common::Log::initDictionaries();
+    const auto &records = dfl::outputs::ContingenciesHistory(argv[1]).read();
+    if (argc == 3) {
+      if (!printContingency(records, argv[2])) {
+        std::cerr << "Contingency " << argv[2] << " not found in " << argv[1] << std::endl;
+        return EXIT_FAILURE;
+      }
+    } else {
+      printSummaries(records);
+    }
+  } catch (DYN::Error &e) {
+    std::cerr << "Reading history failed: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (DYN::MessageError &e) {
+    std::cerr << "Reading history failed: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (std::exception &e) {
+    std::cerr << "Reading history failed: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
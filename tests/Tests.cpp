@@ -12,6 +12,7 @@
 
 #include <DYNFileSystemUtils.h>
 #include <fstream>
+#include <sstream>
 
 namespace dfl {
 namespace test {
@@ -55,5 +56,28 @@ void checkFilesEqual(const std::string &lfilepath, const std::string &rfilepath)
   }
 }
 
+boost::filesystem::path testDirectory(const std::string &testName) {
+  boost::filesystem::path testDir(outputPathResults);
+  testDir.append(testName);
+  boost::filesystem::remove_all(testDir);
+  boost::filesystem::create_directories(testDir);
+  return testDir;
+}
+
+void writeFile(const boost::filesystem::path &filepath, const std::string &content) {
+  if (!filepath.parent_path().empty()) {
+    boost::filesystem::create_directories(filepath.parent_path());
+  }
+  std::ofstream ofs(filepath.generic_string(), std::ios::binary);
+  ofs << content;
+}
+
+std::string readFile(const boost::filesystem::path &filepath) {
+  std::ifstream ifs(filepath.generic_string(), std::ios::binary);
+  std::stringstream content;
+  content << ifs.rdbuf();
+  return content.str();
+}
+
 }  // namespace test
 }  // namespace dfl
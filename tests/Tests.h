@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <boost/filesystem.hpp>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <string>
@@ -18,5 +19,29 @@ static const std::string outputPathResults("resultsTestsTmp");
 namespace dfl {
 namespace test {
 void checkFilesEqual(const std::string& lfilepath, const std::string& rfilepath);
+
+/**
+ * @brief Create an empty directory of the test results
+ *
+ * @param testName the name of the test, used as directory name
+ * @returns the path of the directory, emptied if it already existed
+ */
+boost::filesystem::path testDirectory(const std::string& testName);
+
+/**
+ * @brief Write a file, creating its parent directories if needed
+ *
+ * @param filepath the path of the file
+ * @param content the content of the file
+ */
+void writeFile(const boost::filesystem::path& filepath, const std::string& content);
+
+/**
+ * @brief Read the whole content of a file
+ *
+ * @param filepath the path of the file
+ * @returns the content of the file, empty if it cannot be read
+ */
+std::string readFile(const boost::filesystem::path& filepath);
 }  // namespace test
 }  // namespace dfl
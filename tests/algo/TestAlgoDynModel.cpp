@@ -140,6 +140,7 @@ TEST(TestAlgoDynModel, base) {
   for (const auto &node : nodes) {
     algo(node, algoRes);
   }
+  algo.storeMacroConnections();
 
   ASSERT_EQ(defs.usedMacroConnections.size(), 12);
   std::set<std::string> usedMacroConnections(defs.usedMacroConnections.begin(), defs.usedMacroConnections.end());
@@ -323,6 +324,7 @@ TEST(TestAlgoDynModel, noRegulation) {
   for (const auto &node : nodes) {
     algo(node, algoRes);
   }
+  algo.storeMacroConnections();
 
   ASSERT_EQ(defs.usedMacroConnections.size(), 9);
   std::set<std::string> usedMacroConnections(defs.usedMacroConnections.begin(), defs.usedMacroConnections.end());
@@ -480,6 +482,7 @@ TEST(TestAlgoDynModel, noRegulationAndBusDisconnected) {
   for (const auto &node : nodes) {
     algo(node, algoRes);
   }
+  algo.storeMacroConnections();
 
   ASSERT_EQ(defs.usedMacroConnections.size(), 9);
   std::set<std::string> usedMacroConnections(defs.usedMacroConnections.begin(), defs.usedMacroConnections.end());
@@ -575,3 +578,29 @@ TEST(TestAlgoDynModel, noRegulationAndBusDisconnected) {
   ASSERT_EQ(found_connection->connectedElementId, "G3");
   ASSERT_EQ(found_connection->elementType, dfl::algo::DynamicModelDefinition::MacroConnection::ElementType::GENERATOR);
 }
+
+TEST(TestAlgoDynModel, MacroConnectionsOrdering) {
+  using MacroConnection = dfl::algo::DynamicModelDefinition::MacroConnection;
+
+  // the fields are compared one after the other, so that fields ending with digits are not mixed up
+  MacroConnection first("X", MacroConnection::ElementType::LINE, "2Y", "");
+  MacroConnection second("X1", MacroConnection::ElementType::TFO, "Y", "");
+  ASSERT_TRUE(first < second);
+  ASSERT_FALSE(second < first);
+  ASSERT_NE(first, second);
+  ASSERT_TRUE(MacroConnection("X", MacroConnection::ElementType::NODE, "Z", "") < first);
+  ASSERT_TRUE(MacroConnection("X", MacroConnection::ElementType::LINE, "1Y", "") < first);
+
+  // an automaton with many connections, inserted in any order and twice each
+  dfl::algo::DynamicModelDefinition dynModel("SVC", "SecondaryVoltageControlSimp");
+  const unsigned int nbGenerators = 2000;
+  for (unsigned int i = 0; i < 2 * nbGenerators; ++i) {
+    const unsigned int index = (i * 7919) % nbGenerators;
+    dynModel.nodeConnections.insert(MacroConnection("SVCToGenerator", MacroConnection::ElementType::GENERATOR, "G" + std::to_string(index), ""));
+  }
+  dynModel.nodeConnections.insert(MacroConnection("SVCToUMeasurement", MacroConnection::ElementType::NODE, "VL", ""));
+  ASSERT_EQ(dynModel.nodeConnections.size(), nbGenerators + 1);
+  ASSERT_TRUE(std::is_sorted(dynModel.nodeConnections.begin(), dynModel.nodeConnections.end()));
+  ASSERT_EQ(dynModel.nodeConnections.rbegin()->id, "SVCToUMeasurement");
+  ASSERT_EQ(dynModel.nodeConnections.count(MacroConnection("SVCToGenerator", MacroConnection::ElementType::GENERATOR, "G42", "")), 1);
+}
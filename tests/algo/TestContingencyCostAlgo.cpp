@@ -0,0 +1,78 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  TestContingencyCostAlgo.cpp
+ *
+ * @brief Contingency cost estimation Algo library test file
+ *
+ */
+
+#include "ContingencyCostAlgorithm.h"
+#include "Tests.h"
+
+#include <DYNMultiProcessingContext.h>
+
+DYNAlgorithms::multiprocessing::Context mpiContext;
+
+class ContingencyCostTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    using Type = dfl::inputs::ContingencyElement::Type;
+    auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+    nodes_ = {dfl::inputs::Node::build("A", vl, 400.0, {}), dfl::inputs::Node::build("B", vl, 400.0, {}), dfl::inputs::Node::build("C", vl, 225.0, {}),
+              dfl::inputs::Node::build("D", vl, 63.0, {})};
+    // A and B are linked by parallel lines, B-C and C-D are bridges
+    lines_ = {dfl::inputs::Line::build("L_AB1", nodes_[0], nodes_[1], "UNDEFINED", true, true),
+              dfl::inputs::Line::build("L_AB2", nodes_[0], nodes_[1], "UNDEFINED", true, true),
+              dfl::inputs::Line::build("L_BC", nodes_[1], nodes_[2], "UNDEFINED", true, true),
+              dfl::inputs::Line::build("L_CD", nodes_[2], nodes_[3], "UNDEFINED", true, true)};
+    nodes_[3]->loads.emplace_back("LOAD", false, false);
+
+    for (const auto &contingency : std::vector<std::pair<std::string, std::string>>{{"load", "LOAD"}, {"ab", "L_AB1"}, {"bc", "L_BC"}, {"cd", "L_CD"}}) {
+      contingencies_.emplace_back(contingency.first);
+      contingencies_.back().elements.emplace_back(contingency.second, contingency.first == "load" ? Type::LOAD : Type::LINE);
+    }
+
+    dfl::algo::ContingencyCostAlgorithm algo(costs_);
+    std::shared_ptr<dfl::algo::AlgorithmsResults> algoRes(new dfl::algo::AlgorithmsResults());
+    for (const auto &node : nodes_) {
+      algo(node, algoRes);
+    }
+  }
+
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes_;  ///< nodes of the network
+  std::vector<std::shared_ptr<dfl::inputs::Line>> lines_;  ///< lines of the network
+  std::vector<dfl::inputs::Contingency> contingencies_;    ///< contingencies to simulate
+  dfl::algo::ContingencyCosts costs_;                      ///< costs of the contingencies
+};
+
+TEST_F(ContingencyCostTest, estimation) {
+  auto costs = costs_.estimate(contingencies_, nodes_[0], {});
+  ASSERT_EQ(4, costs.size());
+  ASSERT_DOUBLE_EQ(4., costs.at("ab"));
+  ASSERT_DOUBLE_EQ(2. * 1.5 * 2., costs.at("bc"));
+  ASSERT_DOUBLE_EQ((1. + 225. / 400.) * (1. + 1. / 3.) * 2., costs.at("cd"));
+  ASSERT_DOUBLE_EQ((1. + 63. / 400.) * 1.25, costs.at("load"));
+
+  auto order = dfl::algo::ContingencyCosts::longestFirst(contingencies_, costs);
+  std::vector<std::string> ids;
+  for (auto index : order) {
+    ids.push_back(contingencies_[index].id);
+  }
+  ASSERT_EQ((std::vector<std::string>{"bc", "cd", "ab", "load"}), ids);
+}
+
+TEST_F(ContingencyCostTest, history) {
+  auto costs = costs_.estimate(contingencies_, nodes_[0], {{"ab", 8.}, {"unknown", 100.}});
+  ASSERT_DOUBLE_EQ(8., costs.at("ab"));
+  ASSERT_DOUBLE_EQ(2. * 6., costs.at("bc"));
+  ASSERT_DOUBLE_EQ(2. * (1. + 63. / 400.) * 1.25, costs.at("load"));
+}
@@ -8,6 +8,8 @@
 // SPDX-License-Identifier: MPL-2.0
 //
 
+#include <boost/filesystem.hpp>
+#include <fstream>
 #include <memory>
 
 #include <DYNMultiProcessingContext.h>
@@ -106,3 +108,77 @@ TEST(DynModelFilter, RemoveRPCLIfMissingConnexionToSvc) {
     ASSERT_EQ(modelsIt2, models.end());
   }
 }
+
+TEST(DynModelFilter, SyntheticDataBase) {
+  // hundreds of SVC zones controlling tens of thousands of generators: only zones with an even index are connected to their U measurement
+  const unsigned int nbZones = 200;
+  const unsigned int nbGeneratorsByZone = 100;
+  boost::filesystem::path testDir(outputPathResults);
+  testDir.append("TestDynModelFilterSynthetic");
+  boost::filesystem::remove_all(testDir);
+  boost::filesystem::create_directories(testDir);
+  boost::filesystem::path assemblingFilePath(testDir);
+  assemblingFilePath.append("assembling.xml");
+
+  std::vector<dfl::algo::GeneratorDefinition> generators;
+  generators.reserve(nbZones * nbGeneratorsByZone);
+  std::map<DynamicModelDefinition::DynModelId, DynamicModelDefinition> models;
+  const std::vector<dfl::inputs::Generator::ReactiveCurvePoint> points;
+  {
+    std::ofstream ofs(assemblingFilePath.generic_string());
+    ofs << "<?xml version='1.0' encoding='UTF-8'?>\n<assembling>\n";
+    for (unsigned int zone = 0; zone < nbZones; ++zone) {
+      const std::string zoneId = std::to_string(zone);
+      const bool connected = zone % 2 == 0;
+      DynamicModelDefinition svc("SVC_" + zoneId, dfl::common::constants::svcModelName);
+      DynamicModelDefinition phaseShifter("PS_" + zoneId, "PhaseShifterI");
+      ofs << "  <singleAssociation id=\"U_" << zoneId << "\">\n    <bus voltageLevel=\"VL_" << zoneId << "\"/>\n  </singleAssociation>\n";
+      for (unsigned int i = 0; i < nbGeneratorsByZone; ++i) {
+        const std::string genId = "GEN_" + zoneId + "_" + std::to_string(i);
+        // the first generator of each zone uses the network model
+        auto model = i == 0 ? dfl::algo::GeneratorDefinition::ModelType::NETWORK : dfl::algo::GeneratorDefinition::ModelType::SIGNALN_RPCL_INFINITE;
+        generators.push_back(dfl::algo::GeneratorDefinition(genId, model, "0", points, 0, 0, 0, 0, 0, 0, "VL_" + zoneId));
+        ofs << "  <singleAssociation id=\"" << genId << "\">\n    <generator name=\"" << genId << "\"/>\n  </singleAssociation>\n";
+        svc.nodeConnections.insert(
+            DynamicModelDefinition::MacroConnection("SVCToGenerator", DynamicModelDefinition::MacroConnection::ElementType::GENERATOR, genId, ""));
+      }
+      ofs << "  <dynamicAutomaton id=\"SVC_" << zoneId << "\" lib=\"" << dfl::common::constants::svcModelName << "\">\n";
+      ofs << "    <macroConnect macroConnection=\"SVCToUMeasurement\" id=\"U_" << zoneId << "\"/>\n";
+      for (unsigned int i = 0; i < nbGeneratorsByZone; ++i) {
+        ofs << "    <macroConnect macroConnection=\"SVCToGenerator\" id=\"GEN_" << zoneId << "_" << i << "\"/>\n";
+      }
+      ofs << "  </dynamicAutomaton>\n";
+      ofs << "  <dynamicAutomaton id=\"PS_" << zoneId << "\" lib=\"PhaseShifterI\">\n";
+      ofs << "    <macroConnect macroConnection=\"PhaseShifterToIMeasurement\" id=\"U_" << zoneId << "\"/>\n";
+      ofs << "  </dynamicAutomaton>\n";
+      if (connected) {
+        svc.nodeConnections.insert(
+            DynamicModelDefinition::MacroConnection("SVCToUMeasurement", DynamicModelDefinition::MacroConnection::ElementType::NODE, "VL_" + zoneId, ""));
+        phaseShifter.nodeConnections.insert(DynamicModelDefinition::MacroConnection(
+            "PhaseShifterToIMeasurement", DynamicModelDefinition::MacroConnection::ElementType::NODE, "VL_" + zoneId, ""));
+      }
+      models.insert({svc.id, svc});
+      models.insert({phaseShifter.id, phaseShifter});
+    }
+    ofs << "</assembling>\n";
+  }
+
+  dfl::inputs::AssemblingDataBase assembling(assemblingFilePath);
+  dfl::algo::DynModelFilterAlgorithm dynModelFilterAlgorithm(assembling, generators, models);
+  dynModelFilterAlgorithm.filter();
+
+  ASSERT_EQ(models.size(), nbZones);
+  for (unsigned int zone = 0; zone < nbZones; ++zone) {
+    const std::string zoneId = std::to_string(zone);
+    const bool connected = zone % 2 == 0;
+    ASSERT_EQ(models.count("SVC_" + zoneId), connected ? 1 : 0);
+    ASSERT_EQ(models.count("PS_" + zoneId), connected ? 1 : 0);
+    if (connected) {
+      // the generator using the network model is disconnected from the SVC
+      ASSERT_EQ(models.at("SVC_" + zoneId).nodeConnections.size(), nbGeneratorsByZone);
+    }
+    for (unsigned int i = 1; i < nbGeneratorsByZone; ++i) {
+      ASSERT_EQ(generators[zone * nbGeneratorsByZone + i].hasRpcl(), connected);
+    }
+  }
+}
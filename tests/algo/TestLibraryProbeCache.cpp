@@ -0,0 +1,75 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  TestLibraryProbeCache.cpp
+ *
+ * @brief Library probe cache test file
+ *
+ */
+
+#include "LibraryProbeCache.h"
+#include "Tests.h"
+
+#include <boost/filesystem.hpp>
+#include <cstdlib>
+#include <fstream>
+
+static boost::filesystem::path dummyLibrary() {
+  boost::filesystem::path path(getenv("DYNAFLOW_LAUNCHER_LIBRARIES"));
+  path.append("dummyLib.so");
+  return path;
+}
+
+TEST(LibraryProbeCache, addAndWrite) {
+  const auto &testDir = dfl::test::testDirectory("TestLibraryProbeCache");
+  boost::filesystem::path library(testDir);
+  library.append("dummyLib.so");
+  boost::filesystem::copy_file(dummyLibrary(), library);
+  boost::filesystem::path cacheFile(testDir);
+  cacheFile.append("probes.txt");
+
+  dfl::algo::LibraryProbeCache cache(cacheFile);
+  ASSERT_FALSE(cache.contains(library));
+  cache.add(library);
+#ifdef __linux__
+  ASSERT_TRUE(cache.contains(library));
+#endif
+  cache.write();
+  ASSERT_TRUE(boost::filesystem::exists(cacheFile));
+
+  // entries are read by another run
+  dfl::algo::LibraryProbeCache cache2(cacheFile);
+#ifdef __linux__
+  ASSERT_TRUE(cache2.contains(library));
+#endif
+
+  // modified library must be probed again
+  {
+    std::ofstream ofs(library.generic_string(), std::ios::app);
+    ofs << "modified";
+  }
+  ASSERT_FALSE(cache2.contains(library));
+}
+
+TEST(LibraryProbeCache, header) {
+  const auto &testDir = dfl::test::testDirectory("TestLibraryProbeCacheHeader");
+  boost::filesystem::path textFile(testDir);
+  textFile.append("notALibrary.so");
+  {
+    std::ofstream ofs(textFile.generic_string());
+    ofs << "not a library";
+  }
+
+  ASSERT_FALSE(dfl::algo::LibraryProbeCache::isLoadableHeader(textFile));
+#ifdef __linux__
+  ASSERT_TRUE(dfl::algo::LibraryProbeCache::isLoadableHeader(dummyLibrary()));
+#endif
+}
@@ -0,0 +1,67 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "Fingerprint.h"
+#include "Tests.h"
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST(Fingerprint, values) {
+  dfl::common::Fingerprint fingerprint1;
+  fingerprint1 << "A" << 1.5 << 2;
+  dfl::common::Fingerprint fingerprint2;
+  fingerprint2 << "A" << 1.5 << 2;
+  dfl::common::Fingerprint fingerprint3;
+  fingerprint3 << "A" << 1.5000000001 << 2;
+  dfl::common::Fingerprint fingerprint4;
+  fingerprint4 << "A1" << 5 << 2;
+
+  ASSERT_EQ(fingerprint1.str(), fingerprint2.str());
+  ASSERT_NE(fingerprint1.str(), fingerprint3.str());
+  ASSERT_NE(fingerprint1.str(), fingerprint4.str());
+
+  // the values are delimited by their sizes, whatever their content
+  dfl::common::Fingerprint fingerprint5;
+  fingerprint5 << "A:" << "B";
+  dfl::common::Fingerprint fingerprint6;
+  fingerprint6 << "A" << ":B";
+  ASSERT_NE(fingerprint5.str(), fingerprint6.str());
+  ASSERT_EQ(fingerprint5.str().size(), 64);
+}
+
+TEST(Fingerprint, ofFile) {
+  boost::filesystem::path outputDir(outputPathResults);
+  outputDir.append("TestFingerprint");
+  boost::filesystem::remove_all(outputDir);
+  boost::filesystem::create_directories(outputDir);
+  boost::filesystem::path file(outputDir);
+  file.append("file.par");
+  std::ofstream ofs(file.generic_string());
+  ofs << "content";
+  ofs.close();
+
+  ASSERT_EQ("ed7002b439e9ac845f22357d822bac1444730fbdb6016d3ec9432297b9ec9f73", dfl::common::Fingerprint::ofFile(file));
+  // a missing file has the fingerprint of an empty content
+  ASSERT_EQ("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", dfl::common::Fingerprint::ofFile(outputDir / "missing.par"));
+
+  // contents filling the last block up to its size or spanning several blocks
+  const std::vector<std::pair<std::string, std::string>> contents = {
+      {std::string(55, 'x'), "d5e285683cd4efc02d021a5c62014694958901005d6f71e89e0989fac77e4072"},
+      {std::string(64, 'x'), "7ce100971f64e7001e8fe5a51973ecdfe1ced42befe7ee8d5fd6219506b5393c"},
+      {std::string(1000, 'a'), "41edece42d63e8d9bf515a9ba6932e1c20cbc9f5a5d134645adb5db1b9737ea3"}};
+  for (const auto &content : contents) {
+    dfl::test::writeFile(file, content.first);
+    ASSERT_EQ(content.second, dfl::common::Fingerprint::ofFile(file));
+  }
+}
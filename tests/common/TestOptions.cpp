@@ -65,6 +65,7 @@ TEST(Options, nominal) {
   char* argv[] = {argv0, argv1, argv2};
   auto status = options.parse(3, argv);
   ASSERT_EQ(dfl::common::Options::Request::RUN_SIMULATION_N, status);
+  ASSERT_FALSE(options.config().resume);
 }
 
 TEST(Options, nominalLogLevel) {
@@ -219,3 +220,31 @@ TEST(Options, NSAWrongLogLevel) {
   auto status = options.parse(6, argv);
   ASSERT_EQ(dfl::common::Options::Request::ERROR, status);
 }
+
+/*  Resume  */
+
+TEST(Options, resume) {
+  dfl::common::Options options;
+
+  char argv0[] = {"DynaFlowLauncher"};
+  char argv1[] = {"--network=test.iidm"};
+  char argv2[] = {"--config=test.json"};
+  char argv3[] = {"--contingencies=test.json"};
+  char argv4[] = {"--resume"};
+  char* argv[] = {argv0, argv1, argv2, argv3, argv4};
+  auto status = options.parse(5, argv);
+  ASSERT_EQ(dfl::common::Options::Request::RUN_SIMULATION_SA, status);
+  ASSERT_TRUE(options.config().resume);
+}
+
+TEST(Options, resumeMissingContingencies) {
+  dfl::common::Options options;
+
+  char argv0[] = {"DynaFlowLauncher"};
+  char argv1[] = {"--network=test.iidm"};
+  char argv2[] = {"--config=test.json"};
+  char argv3[] = {"--resume"};
+  char* argv[] = {argv0, argv1, argv2, argv3};
+  auto status = options.parse(4, argv);
+  ASSERT_EQ(dfl::common::Options::Request::ERROR, status);
+}
@@ -0,0 +1,69 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "Parallel.h"
+#include "Tests.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(Parallel, allTasksRun) {
+  for (unsigned int nbWorkers : {0u, 1u, 4u, 64u}) {
+    std::vector<std::atomic<int>> runs(50);
+    for (auto &run : runs) {
+      run = 0;
+    }
+    dfl::common::runParallel(runs.size(), nbWorkers, [&runs](std::size_t index) { ++runs[index]; });
+    for (const auto &run : runs) {
+      ASSERT_EQ(1, run);
+    }
+  }
+}
+
+TEST(Parallel, noTask) {
+  bool called = false;
+  dfl::common::runParallel(0, 4, [&called](std::size_t) { called = true; });
+  ASSERT_FALSE(called);
+}
+
+TEST(Parallel, exception) {
+  std::atomic<int> nbRuns(0);
+  ASSERT_THROW(dfl::common::runParallel(100, 4,
+                                        [&nbRuns](std::size_t index) {
+                                          ++nbRuns;
+                                          if (index == 10) {
+                                            throw std::runtime_error("task failed");
+                                          }
+                                        }),
+               std::runtime_error);
+  ASSERT_GE(nbRuns, 11);
+}
+
+TEST(Parallel, exceptionOfFirstTask) {
+  // the last task fails first in time, the error of the first one is reported whatever the timing
+  for (int run = 0; run < 20; ++run) {
+    try {
+      dfl::common::runParallel(3, 3, [](std::size_t index) {
+        if (index == 0) {
+          std::this_thread::sleep_for(std::chrono::milliseconds(20));
+          throw std::runtime_error("network");
+        } else if (index == 2) {
+          throw std::logic_error("contingencies");
+        }
+      });
+      FAIL();
+    } catch (const std::runtime_error &e) {
+      ASSERT_EQ(std::string("network"), e.what());
+    }
+  }
+}
@@ -196,3 +196,34 @@ TEST(AssemblingXmlDocument, AssemblingContainsSVC) {
   dfl::inputs::AssemblingDataBase assembling(filepath);
   ASSERT_TRUE(assembling.containsSVC());
 }
+
+TEST(AssemblingXmlDocument, AssemblingIndexes) {
+  const std::string filepath = "res/assembling_svc.xml";
+  dfl::inputs::AssemblingDataBase assembling(filepath);
+
+  const auto& singleAssociations = assembling.getSingleAssociations("SVC");
+  ASSERT_EQ(singleAssociations.size(), 3);
+  ASSERT_EQ(singleAssociations[0], &assembling.getSingleAssociation("UMeasurement"));
+  ASSERT_EQ(singleAssociations[1], &assembling.getSingleAssociation("GEN1"));
+  ASSERT_EQ(singleAssociations[2], &assembling.getSingleAssociation("GEN2"));
+  ASSERT_TRUE(assembling.getSingleAssociations("UNKNOWN").empty());
+
+  const auto& automatons = assembling.getAutomatonsFromElement("_GEN____2_SM");
+  ASSERT_EQ(automatons.size(), 1);
+  ASSERT_EQ(automatons.front().automaton, &assembling.dynamicAutomatons().at("SVC"));
+  ASSERT_EQ(automatons.front().singleAssociation, &assembling.getSingleAssociation("GEN2"));
+  ASSERT_TRUE(assembling.getAutomatonsFromElement("_BUS____1_VL").empty());
+
+  ASSERT_TRUE(assembling.hasProperty("_GEN____2_SM", "ReactivePowerControlLoop2"));
+  ASSERT_FALSE(assembling.hasProperty("_GEN____1_SM", "ReactivePowerControlLoop2"));
+  ASSERT_FALSE(assembling.hasProperty("_GEN____2_SM", "MyProp"));
+
+  // the indexes still point to the elements of the database once it is moved
+  dfl::inputs::AssemblingDataBase movedAssembling(std::move(assembling));
+  ASSERT_EQ(movedAssembling.getSingleAssociations("SVC")[1], &movedAssembling.getSingleAssociation("GEN1"));
+
+  // a macro connect to another automaton does not use a single association
+  dfl::inputs::AssemblingDataBase assemblingVirtual("res/assembling.xml");
+  ASSERT_EQ(assemblingVirtual.getSingleAssociations("VIRTUAL_MODEL").size(), 1);
+  ASSERT_EQ(assemblingVirtual.getSingleAssociations("VIRTUAL_MODEL").front(), nullptr);
+}
@@ -59,6 +59,11 @@ TEST(Config, Nominal) {
   ASSERT_FALSE(config.isSVarCRegulationOn());
   ASSERT_FALSE(config.isShuntRegulationOn());
   ASSERT_FALSE(config.isAutomaticSlackBusOn());
+  ASSERT_TRUE(config.isIncrementalExportOn());
+  ASSERT_TRUE(config.isSolverAutoTuningOn());
+  ASSERT_EQ(absolute("/tmp/compilation"), absolute(config.compilationCacheDir().string()));
+  ASSERT_EQ(256, config.getCompilationCacheMaxSize());
+  ASSERT_EQ(absolute("/tmp/libraryProbes.txt"), absolute(config.libraryProbeCacheFile().string()));
 
   std::string prefixConfigFile = remove_file_name(createAbsolutePath("./res/config.json", current_path()));
 
@@ -93,6 +98,11 @@ TEST(Config, Default) {
   ASSERT_TRUE(config.isSVarCRegulationOn());
   ASSERT_TRUE(config.isShuntRegulationOn());
   ASSERT_TRUE(config.isAutomaticSlackBusOn());
+  ASSERT_FALSE(config.isIncrementalExportOn());
+  ASSERT_FALSE(config.isSolverAutoTuningOn());
+  ASSERT_TRUE(config.compilationCacheDir().empty());
+  ASSERT_EQ(1024, config.getCompilationCacheMaxSize());
+  ASSERT_TRUE(config.libraryProbeCacheFile().empty());
   ASSERT_EQ(config.settingFilePath().generic_string(), "");
   ASSERT_EQ(config.assemblingFilePath().generic_string(), "");
   ASSERT_EQ(boost::filesystem::current_path().generic_string(), config.outputDir());
@@ -174,8 +184,33 @@ TEST(Config, ConfigSA) {
     ASSERT_DOUBLE_EQUALS_DYNAWO(50, config.getTimeOfEvent());
     if (configFile == "res/config_SA.json") {
       ASSERT_EQ(canonical(config.startingDumpFilePath().string()), canonical("myStartingDumpFile.dmp", prefixConfigFile));
+      ASSERT_TRUE(config.isArchiveSAOutputsOn());
+      ASSERT_TRUE(config.isRemoveArchivedSAOutputsOn());
+      ASSERT_EQ(4, config.getNbProcesses());
+      ASSERT_EQ(absolute("/tmp/history"), absolute(config.historyDir().string()));
+      ASSERT_EQ(absolute("/tmp/cache"), absolute(config.resultCacheDir().string()));
+      ASSERT_EQ(512, config.getResultCacheMaxSize());
+      ASSERT_DOUBLE_EQUALS_DYNAWO(600., config.getScenarioTimeout());
+      ASSERT_DOUBLE_EQUALS_DYNAWO(0.1, config.getScenarioMinTimeStep());
+      const auto &solverProfiles = config.getSolverProfiles();
+      ASSERT_EQ(2, solverProfiles.size());
+      ASSERT_EQ(2, solverProfiles[0].size());
+      ASSERT_DOUBLE_EQUALS_DYNAWO(0.01, solverProfiles[0].at("hMin"));
+      ASSERT_DOUBLE_EQUALS_DYNAWO(30., solverProfiles[0].at("mxiter"));
+      ASSERT_EQ(2, solverProfiles[1].size());
+      ASSERT_DOUBLE_EQUALS_DYNAWO(0.001, solverProfiles[1].at("hMin"));
+      ASSERT_DOUBLE_EQUALS_DYNAWO(20., solverProfiles[1].at("maxNewtonTry"));
     } else {
       ASSERT_TRUE(config.startingDumpFilePath().empty());
+      ASSERT_FALSE(config.isArchiveSAOutputsOn());
+      ASSERT_FALSE(config.isRemoveArchivedSAOutputsOn());
+      ASSERT_EQ(0, config.getNbProcesses());
+      ASSERT_EQ(absolute(config.outputDir().string()), absolute(config.historyDir().string()));
+      ASSERT_TRUE(config.resultCacheDir().empty());
+      ASSERT_EQ(1024, config.getResultCacheMaxSize());
+      ASSERT_DOUBLE_EQUALS_DYNAWO(0., config.getScenarioTimeout());
+      ASSERT_DOUBLE_EQUALS_DYNAWO(1., config.getScenarioMinTimeStep());
+      ASSERT_TRUE(config.getSolverProfiles().empty());
     }
 #if _DEBUG_
     ASSERT_TRUE(config.isChosenOutput(dfl::inputs::Configuration::ChosenOutputEnum::STEADYSTATE));
@@ -0,0 +1,169 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "DynamicDataBaseBinary.h"
+#include "DynamicDataBaseManager.h"
+#include "Tests.h"
+
+#include <DYNMultiProcessingContext.h>
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <gtest_dynawo.h>
+
+testing::Environment* initXmlEnvironment();
+
+testing::Environment* const env = initXmlEnvironment();
+
+DYNAlgorithms::multiprocessing::Context mpiContext;
+
+TEST(DynamicDataBaseBinary, writeAndRead) {
+  const auto& testDir = dfl::test::testDirectory("TestDynamicDataBaseBinary");
+  boost::filesystem::path binaryFilePath(testDir);
+  binaryFilePath.append("assembling.ddb");
+  dfl::inputs::SettingDataBase setting("res/setting.xml");
+  dfl::inputs::AssemblingDataBase assembling("res/assembling.xml");
+  dfl::inputs::DynamicDataBaseBinary::write(binaryFilePath, "res/setting.xml", "res/assembling.xml", setting, assembling);
+
+  dfl::inputs::SettingDataBase settingRead;
+  dfl::inputs::AssemblingDataBase assemblingRead;
+  ASSERT_TRUE(dfl::inputs::DynamicDataBaseBinary::read(binaryFilePath, settingRead, assemblingRead));
+
+  auto set = settingRead.getSet("MODELE_1_VL4");
+  ASSERT_EQ(set.counts.size(), 1);
+  ASSERT_EQ(set.counts.front().id, "SHUNTS_MODELE_1_VL4");
+  ASSERT_EQ(set.doubleParameters().size(), 3);
+  ASSERT_EQ(set.doubleParameters()[1].name, "uMax");
+  ASSERT_DOUBLE_EQ(set.doubleParameters()[1].value, 243.5);
+  ASSERT_DOUBLE_EQ(set.findDoubleParameter("uMax")->value, 243.5);
+  ASSERT_EQ(set.stringParameters.front().value, "test");
+  set = settingRead.getSet("DM_M661");
+  ASSERT_EQ(set.references.size(), setting.getSet("DM_M661").references.size());
+  ASSERT_EQ(*set.references.front().componentId, "@TFO@");
+  ASSERT_EQ(set.references.front().origName, "i1");
+  ASSERT_EQ(set.references[1].dataType, dfl::inputs::SettingDataBase::Reference::DataType::INT);
+
+  auto macro = assemblingRead.getMacroConnection("ToUMeasurement", true);
+  ASSERT_TRUE(macro.network);
+  ASSERT_EQ(macro.connections.front().var1, "Network_U_IMPIN");
+  macro = assemblingRead.getMacroConnection("ToControlledShunts");
+  ASSERT_FALSE(assemblingRead.hasNetworkMacroConnection("ToControlledShunts"));
+  ASSERT_EQ(macro.indexId, "MyIndexId");
+  ASSERT_EQ(macro.connections.size(), 3);
+  auto singleAssoc = assemblingRead.getSingleAssociation("HVDC_LINE_SIDE2");
+  ASSERT_FALSE(singleAssoc.bus);
+  ASSERT_TRUE(singleAssoc.hvdcLine);
+  ASSERT_EQ(singleAssoc.hvdcLine->converterStation1, dfl::inputs::AssemblingDataBase::HvdcLineConverterSide::SIDE2);
+  ASSERT_EQ(assemblingRead.getSingleAssociation("MESURE_MODELE_1_VL4").bus->voltageLevel, "VLP6");
+  ASSERT_TRUE(assemblingRead.getMultipleAssociation("SHUNTS_MODELE_1_VL4").shunt);
+  ASSERT_EQ(assemblingRead.dynamicAutomatons().size(), assembling.dynamicAutomatons().size());
+  for (const auto& automaton : assembling.dynamicAutomatons()) {
+    const auto& automatonRead = assemblingRead.dynamicAutomatons().at(automaton.first);
+    ASSERT_EQ(automatonRead.lib, automaton.second.lib);
+    ASSERT_EQ(automatonRead.macroConnects.size(), automaton.second.macroConnects.size());
+  }
+  ASSERT_EQ(assemblingRead.containsSVC(), assembling.containsSVC());
+  ASSERT_EQ(assemblingRead.getProperty("MyProp").devices.size(), 2);
+  ASSERT_EQ(assemblingRead.getSingleAssociationFromHvdcLine("MyHvdc"), assembling.getSingleAssociationFromHvdcLine("MyHvdc"));
+  const auto& singleAssociations = assemblingRead.getSingleAssociations("MODELE_1_VL4");
+  ASSERT_EQ(singleAssociations.size(), 3);
+  ASSERT_EQ(singleAssociations[0], &assemblingRead.getSingleAssociation("MESURE_MODELE_1_VL4"));
+  ASSERT_EQ(singleAssociations[1], nullptr);
+  ASSERT_EQ(assemblingRead.getAutomatonsFromElement("_GEN____1_SM").front().automaton, &assemblingRead.dynamicAutomatons().at("MODELE_1_VL4"));
+}
+
+TEST(DynamicDataBaseBinary, invalidFile) {
+  const auto& testDir = dfl::test::testDirectory("TestDynamicDataBaseBinaryInvalid");
+  boost::filesystem::path binaryFilePath(testDir);
+  binaryFilePath.append("assembling.ddb");
+  dfl::inputs::SettingDataBase setting("res/setting.xml");
+  dfl::inputs::AssemblingDataBase assembling("res/assembling.xml");
+  dfl::inputs::DynamicDataBaseBinary::write(binaryFilePath, "res/setting.xml", "res/assembling.xml", setting, assembling);
+
+  // truncated file
+  const auto size = boost::filesystem::file_size(binaryFilePath);
+  boost::filesystem::resize_file(binaryFilePath, size / 2);
+  dfl::inputs::SettingDataBase settingRead;
+  dfl::inputs::AssemblingDataBase assemblingRead;
+  ASSERT_FALSE(dfl::inputs::DynamicDataBaseBinary::read(binaryFilePath, settingRead, assemblingRead));
+  ASSERT_TRUE(assemblingRead.dynamicAutomatons().empty());
+
+  // not a binary file
+  {
+    std::ofstream ofs(binaryFilePath.generic_string());
+    ofs << "<assembling/>";
+  }
+  ASSERT_FALSE(dfl::inputs::DynamicDataBaseBinary::read(binaryFilePath, settingRead, assemblingRead));
+  ASSERT_FALSE(dfl::inputs::DynamicDataBaseBinary::isUpToDate(binaryFilePath, "res/setting.xml", "res/assembling.xml"));
+}
+
+TEST(DynamicDataBaseBinary, manager) {
+  const auto& testDir = dfl::test::testDirectory("TestDynamicDataBaseBinaryManager");
+  boost::filesystem::path settingFilePath(testDir);
+  settingFilePath.append("setting.xml");
+  boost::filesystem::path assemblingFilePath(testDir);
+  assemblingFilePath.append("assembling.xml");
+  boost::filesystem::copy_file("res/setting.xml", settingFilePath);
+  boost::filesystem::copy_file("res/assembling.xml", assemblingFilePath);
+
+  // an empty database is compiled, so that the manager shows which file it read
+  const auto& binaryFilePath = dfl::inputs::DynamicDataBaseBinary::binaryPath(settingFilePath, assemblingFilePath);
+  ASSERT_EQ(binaryFilePath.parent_path(), assemblingFilePath.parent_path());
+  ASSERT_EQ(binaryFilePath.filename().generic_string().find("assembling-"), 0);
+  ASSERT_EQ(binaryFilePath.extension().generic_string(), ".ddb");
+  dfl::inputs::DynamicDataBaseBinary::write(binaryFilePath, settingFilePath, assemblingFilePath, dfl::inputs::SettingDataBase(),
+                                            dfl::inputs::AssemblingDataBase());
+  ASSERT_TRUE(dfl::inputs::DynamicDataBaseBinary::isUpToDate(binaryFilePath, settingFilePath, assemblingFilePath));
+  {
+    dfl::inputs::DynamicDataBaseManager manager(settingFilePath, assemblingFilePath);
+    ASSERT_TRUE(manager.assembling().dynamicAutomatons().empty());
+  }
+
+  // the XML files are read once one of them changed
+  dfl::test::writeFile(assemblingFilePath, dfl::test::readFile(assemblingFilePath) + "<!-- edited -->\n");
+  ASSERT_FALSE(dfl::inputs::DynamicDataBaseBinary::isUpToDate(binaryFilePath, settingFilePath, assemblingFilePath));
+  {
+    dfl::inputs::DynamicDataBaseManager manager(settingFilePath, assemblingFilePath);
+    ASSERT_EQ(manager.assembling().dynamicAutomatons().size(), 4);
+    ASSERT_NO_THROW(manager.setting().getSet("MODELE_1_5P3"));
+  }
+}
+
+TEST(DynamicDataBaseBinary, sources) {
+  const auto& testDir = dfl::test::testDirectory("TestDynamicDataBaseBinarySources");
+  const auto& settingFilePath = testDir / "setting.xml";
+  const auto& assemblingFilePath = testDir / "assembling.xml";
+  const auto& otherSettingFilePath = testDir / "other" / "setting.xml";
+  dfl::test::writeFile(settingFilePath, "<setting/>");
+  dfl::test::writeFile(assemblingFilePath, "<assembling/>");
+  boost::filesystem::create_directories(otherSettingFilePath.parent_path());
+  dfl::test::writeFile(otherSettingFilePath, "<setting/>");
+
+  // each pair of files has its own binary file
+  const auto& binaryFilePath = dfl::inputs::DynamicDataBaseBinary::binaryPath(settingFilePath, assemblingFilePath);
+  ASSERT_EQ(binaryFilePath, dfl::inputs::DynamicDataBaseBinary::binaryPath(testDir / "." / "setting.xml", assemblingFilePath));
+  ASSERT_NE(binaryFilePath, dfl::inputs::DynamicDataBaseBinary::binaryPath(otherSettingFilePath, assemblingFilePath));
+  ASSERT_NE(binaryFilePath, dfl::inputs::DynamicDataBaseBinary::binaryPath("", assemblingFilePath));
+
+  dfl::inputs::DynamicDataBaseBinary::write(binaryFilePath, settingFilePath, assemblingFilePath, dfl::inputs::SettingDataBase(),
+                                            dfl::inputs::AssemblingDataBase());
+  ASSERT_TRUE(dfl::inputs::DynamicDataBaseBinary::isUpToDate(binaryFilePath, settingFilePath, assemblingFilePath));
+  // a file with the same name and content in another directory is another file
+  ASSERT_FALSE(dfl::inputs::DynamicDataBaseBinary::isUpToDate(binaryFilePath, otherSettingFilePath, assemblingFilePath));
+  ASSERT_FALSE(dfl::inputs::DynamicDataBaseBinary::isUpToDate(binaryFilePath, "", assemblingFilePath));
+
+  // an edit keeping the size and the modification time is detected
+  const auto time = boost::filesystem::last_write_time(settingFilePath);
+  dfl::test::writeFile(settingFilePath, "<Setting/>");
+  boost::filesystem::last_write_time(settingFilePath, time);
+  ASSERT_FALSE(dfl::inputs::DynamicDataBaseBinary::isUpToDate(binaryFilePath, settingFilePath, assemblingFilePath));
+  dfl::test::writeFile(settingFilePath, "<setting/>");
+  ASSERT_TRUE(dfl::inputs::DynamicDataBaseBinary::isUpToDate(binaryFilePath, settingFilePath, assemblingFilePath));
+}
@@ -42,15 +42,15 @@ TEST(SettingXmlDocument, readFile) {
   ASSERT_EQ(count.name, "nbShunts");
   ASSERT_EQ(set.boolParameters.size(), 0);
   ASSERT_EQ(set.integerParameters.size(), 0);
-  ASSERT_EQ(set.doubleParameters.size(), 3);
+  ASSERT_EQ(set.doubleParameters().size(), 3);
   ASSERT_EQ(set.stringParameters.size(), 1);
-  auto param = set.doubleParameters[0];
+  auto param = set.doubleParameters()[0];
   ASSERT_EQ(param.name, "uMin");
   ASSERT_EQ(param.value, 236.0);
-  param = set.doubleParameters[1];
+  param = set.doubleParameters()[1];
   ASSERT_EQ(param.name, "uMax");
   ASSERT_EQ(param.value, 243.5);
-  param = set.doubleParameters[2];
+  param = set.doubleParameters()[2];
   ASSERT_EQ(param.name, "delay");
   ASSERT_EQ(param.value, 10.0);
   ASSERT_EQ(set.stringParameters.front().name, "dummy");
@@ -74,7 +74,7 @@ TEST(SettingXmlDocument, readFile) {
   auto param_int = set.integerParameters.front();
   ASSERT_EQ(param_int.name, "modeRegulation");
   ASSERT_EQ(param_int.value, 1);
-  ASSERT_EQ(set.doubleParameters.size(), 16);
+  ASSERT_EQ(set.doubleParameters().size(), 16);
   std::array<std::pair<std::string, double>, 16> values = {std::make_pair("closingSecurityThresholdHV", 228.0),
                                                            std::make_pair("closingRegulationThresholdHV", 230.0),
                                                            std::make_pair("noClosingThresholdHV", 235.0),
@@ -92,8 +92,8 @@ TEST(SettingXmlDocument, readFile) {
                                                            std::make_pair("closingDelayLV", 10.0),
                                                            std::make_pair("openingDelayLV", 8.0)};
   for (unsigned int i = 0; i < values.size(); ++i) {
-    ASSERT_EQ(set.doubleParameters[i].name, values[i].first);
-    ASSERT_EQ(set.doubleParameters[i].value, values[i].second);
+    ASSERT_EQ(set.doubleParameters()[i].name, values[i].first);
+    ASSERT_EQ(set.doubleParameters()[i].value, values[i].second);
   }
 
   set = setting.getSet("DM_M661");
@@ -102,15 +102,15 @@ TEST(SettingXmlDocument, readFile) {
   ASSERT_EQ(set.refs.size(), 0);
   ASSERT_EQ(set.boolParameters.size(), 0);
   ASSERT_EQ(set.integerParameters.size(), 0);
-  ASSERT_EQ(set.doubleParameters.size(), 3);
+  ASSERT_EQ(set.doubleParameters().size(), 3);
   std::array<std::pair<std::string, double>, 3> values6 = {
       std::make_pair("phaseShifter_sign", 1),
       std::make_pair("phaseShifter_t1st", 2.7),
       std::make_pair("phaseShifter_tNext", 2.7),
   };
   for (unsigned int i = 0; i < values6.size(); ++i) {
-    ASSERT_EQ(set.doubleParameters[i].name, values6[i].first);
-    ASSERT_EQ(set.doubleParameters[i].value, values6[i].second);
+    ASSERT_EQ(set.doubleParameters()[i].name, values6[i].first);
+    ASSERT_EQ(set.doubleParameters()[i].value, values6[i].second);
   }
   ASSERT_EQ(set.references.size(), 10);
   std::array<std::tuple<std::string, std::string, dfl::inputs::SettingDataBase::Reference::DataType>, 10> values8 = {
@@ -141,14 +141,14 @@ TEST(SettingXmlDocument, readFile) {
   ASSERT_EQ(ref.id, "MESURE_I_TAILLE");
   ASSERT_EQ(ref.name, "currentLimitAutomaton_Season");
   ASSERT_EQ(ref.tag, "@SAISON@");
-  ASSERT_EQ(set.doubleParameters.size(), 6);
+  ASSERT_EQ(set.doubleParameters().size(), 6);
   std::array<std::pair<std::string, double>, 6> values11_d = {
       std::make_pair("currentLimitAutomaton_IThresholdSummer", 590),        std::make_pair("currentLimitAutomaton_IThresholdWinter1", 689),
       std::make_pair("currentLimitAutomaton_IThresholdWinter2", 759),       std::make_pair("currentLimitAutomaton_IThresholdIntermediate1", 637),
       std::make_pair("currentLimitAutomaton_IThresholdIntermediate2", 637), std::make_pair("currentLimitAutomaton_tLagBeforeActing", 50)};
   for (unsigned int i = 0; i < values11_d.size(); ++i) {
-    ASSERT_EQ(set.doubleParameters[i].name, values11_d[i].first);
-    ASSERT_EQ(set.doubleParameters[i].value, values11_d[i].second);
+    ASSERT_EQ(set.doubleParameters()[i].name, values11_d[i].first);
+    ASSERT_EQ(set.doubleParameters()[i].value, values11_d[i].second);
   }
   ASSERT_EQ(set.integerParameters.size(), 1);
   ASSERT_EQ(set.integerParameters.front().name, "currentLimitAutomaton_OrderToEmit");
@@ -158,6 +158,48 @@ TEST(SettingXmlDocument, readFile) {
   ASSERT_EQ(set.boolParameters.front().value, true);
 }
 
+TEST(SettingXmlDocument, parameterIndexes) {
+  const std::string filepath = "res/setting.xml";
+  dfl::inputs::SettingDataBase setting(filepath);
+  const auto& setFromFile = setting.getSet("DM_TAILLE");
+  ASSERT_NE(setFromFile.findDoubleParameter("currentLimitAutomaton_tLagBeforeActing"), nullptr);
+  ASSERT_EQ(setFromFile.findDoubleParameter("currentLimitAutomaton_tLagBeforeActing")->value, 50);
+  ASSERT_EQ(setFromFile.findDoubleParameter("currentLimitAutomaton_Running"), nullptr);
+
+  dfl::inputs::SettingDataBase::Set set;
+  std::vector<dfl::inputs::SettingDataBase::Parameter<double>> parameters = {
+      {"secondaryVoltageControl_Alpha", 1.},  {"secondaryVoltageControl_Qr_0_", 10.},   {"secondaryVoltageControl_Qr_2_", 12.},
+      {"secondaryVoltageControl_Qr_2_", 20.}, {"secondaryVoltageControl_SNom_1_", 5.},  {"secondaryVoltageControl_Qr_01_", 30.},
+      {"secondaryVoltageControl_Qr_", 40.},   {"secondaryVoltageControl_Qr_100_", 50.}, {"_1_", 60.},
+      {"secondaryVoltageControl_Qr_100_", 70.}};
+  set.setDoubleParameters(std::move(parameters));
+  ASSERT_EQ(set.findDoubleParameter("secondaryVoltageControl_Alpha")->value, 1.);
+  ASSERT_EQ(set.findDoubleParameter("secondaryVoltageControl_Beta"), nullptr);
+  // the first parameter of a name is found by its name, the last one by its family and its index
+  ASSERT_EQ(set.findDoubleParameter("secondaryVoltageControl_Qr_2_")->value, 12.);
+  ASSERT_EQ(*set.getIndexedDoubleParameter("secondaryVoltageControl_Qr_", 0), 10.);
+  ASSERT_FALSE(set.getIndexedDoubleParameter("secondaryVoltageControl_Qr_", 1));
+  ASSERT_EQ(*set.getIndexedDoubleParameter("secondaryVoltageControl_Qr_", 2), 20.);
+  ASSERT_EQ(*set.getIndexedDoubleParameter("secondaryVoltageControl_SNom_", 1), 5.);
+  ASSERT_FALSE(set.getIndexedDoubleParameter("secondaryVoltageControl_SNom_", 0));
+  ASSERT_FALSE(set.getIndexedDoubleParameter("secondaryVoltageControl_U0Pu_", 0));
+  // indexes beyond the number of parameters are found by their name
+  ASSERT_EQ(set.findDoubleParameter("secondaryVoltageControl_Qr_100_")->value, 50.);
+  ASSERT_EQ(*set.getIndexedDoubleParameter("secondaryVoltageControl_Qr_", 100), 70.);
+  ASSERT_FALSE(set.getIndexedDoubleParameter("secondaryVoltageControl_Qr_", 101));
+  // names which are not built from a family and an index are only found by their name
+  ASSERT_EQ(set.findDoubleParameter("secondaryVoltageControl_Qr_01_")->value, 30.);
+  ASSERT_EQ(set.findDoubleParameter("_1_")->value, 60.);
+  ASSERT_FALSE(set.getIndexedDoubleParameter("_", 1));
+
+  // the indexes follow the parameters when they are replaced
+  set.setDoubleParameters({{"secondaryVoltageControl_Beta", 1.}, {"secondaryVoltageControl_Qr_0_", 15.}});
+  ASSERT_EQ(*set.getIndexedDoubleParameter("secondaryVoltageControl_Qr_", 0), 15.);
+  ASSERT_FALSE(set.getIndexedDoubleParameter("secondaryVoltageControl_Qr_", 2));
+  ASSERT_EQ(set.findDoubleParameter("secondaryVoltageControl_Alpha"), nullptr);
+  ASSERT_EQ(set.findDoubleParameter("secondaryVoltageControl_Beta")->value, 1.);
+}
+
 TEST(SettingXmlDocument, error) {
   const std::string filepath = "res/setting_error.xml";
   ASSERT_ANY_THROW(dfl::inputs::SettingDataBase setting(filepath));
@@ -0,0 +1,54 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "Tests.h"
+#include "XsdValidationStamp.h"
+
+#include <boost/filesystem.hpp>
+#include <cstdlib>
+
+TEST(XsdValidationStamp, stamp) {
+  const auto& testDir = dfl::test::testDirectory("TestXsdValidationStamp");
+  boost::filesystem::path cacheDir(testDir);
+  cacheDir.append("cache");
+  boost::filesystem::path documentPath(testDir);
+  documentPath.append("assembling.xml");
+  boost::filesystem::path xsdPath(testDir);
+  xsdPath.append("assembling.xsd");
+  dfl::test::writeFile(documentPath, "<assembling/>");
+  dfl::test::writeFile(xsdPath, "<xs:schema/>");
+
+  // stamps are not used without cache directory
+  unsetenv("DYNAFLOW_LAUNCHER_XSD_VALIDATION_CACHE");
+  unsetenv("DYNAFLOW_LAUNCHER_FORCE_XSD_VALIDATION");
+  dfl::inputs::XsdValidationStamp(documentPath, xsdPath).setValidated();
+  ASSERT_FALSE(dfl::inputs::XsdValidationStamp(documentPath, xsdPath).isValidated());
+  ASSERT_FALSE(boost::filesystem::exists(cacheDir));
+
+  setenv("DYNAFLOW_LAUNCHER_XSD_VALIDATION_CACHE", cacheDir.c_str(), 1);
+  ASSERT_FALSE(dfl::inputs::XsdValidationStamp(documentPath, xsdPath).isValidated());
+  dfl::inputs::XsdValidationStamp(documentPath, xsdPath).setValidated();
+  ASSERT_TRUE(dfl::inputs::XsdValidationStamp(documentPath, xsdPath).isValidated());
+  ASSERT_FALSE(dfl::inputs::XsdValidationStamp(documentPath, "").isValidated());
+
+  setenv("DYNAFLOW_LAUNCHER_FORCE_XSD_VALIDATION", "true", 1);
+  ASSERT_FALSE(dfl::inputs::XsdValidationStamp(documentPath, xsdPath).isValidated());
+  unsetenv("DYNAFLOW_LAUNCHER_FORCE_XSD_VALIDATION");
+
+  // any change of the document or of the XSD requires a new validation
+  dfl::test::writeFile(documentPath, "<assembling></assembling>");
+  ASSERT_FALSE(dfl::inputs::XsdValidationStamp(documentPath, xsdPath).isValidated());
+  dfl::test::writeFile(documentPath, "<assembling/>");
+  ASSERT_TRUE(dfl::inputs::XsdValidationStamp(documentPath, xsdPath).isValidated());
+  dfl::test::writeFile(xsdPath, "<xs:schema></xs:schema>");
+  ASSERT_FALSE(dfl::inputs::XsdValidationStamp(documentPath, xsdPath).isValidated());
+
+  unsetenv("DYNAFLOW_LAUNCHER_XSD_VALIDATION_CACHE");
+}
@@ -0,0 +1,66 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "CompilationCache.h"
+#include "Tests.h"
+
+#include <boost/filesystem.hpp>
+#include <ctime>
+
+TEST(CompilationCache, storeAndRestore) {
+  const auto &testDir = dfl::test::testDirectory("TestCompilationCache");
+  dfl::outputs::CompilationCache cache(testDir / "cache", 1024 * 1024);
+  const auto &compileDirectory = testDir / "C1" / "outputs" / "compilation";
+  dfl::test::writeFile(compileDirectory / "Model1.so", "model1");
+  dfl::test::writeFile(compileDirectory / "Model1" / "Model1.cpp", "source1");
+
+  ASSERT_EQ(0, cache.restore("key1", testDir / "C0" / "outputs" / "compilation"));
+  ASSERT_EQ(2, cache.store("key1", compileDirectory));
+  // files already in the entry are not stored again
+  ASSERT_EQ(0, cache.store("key1", compileDirectory));
+  dfl::test::writeFile(compileDirectory / "Model2.so", "model2");
+  ASSERT_EQ(1, cache.store("key1", compileDirectory));
+
+  const auto &otherCompileDirectory = testDir / "C2" / "outputs" / "compilation";
+  dfl::test::writeFile(otherCompileDirectory / "Model2.so", "compiled by C2");
+  ASSERT_EQ(2, cache.restore("key1", otherCompileDirectory));
+  ASSERT_EQ("model1", dfl::test::readFile(otherCompileDirectory / "Model1.so"));
+  ASSERT_EQ("source1", dfl::test::readFile(otherCompileDirectory / "Model1" / "Model1.cpp"));
+  // files already in the compilation directory are kept
+  ASSERT_EQ("compiled by C2", dfl::test::readFile(otherCompileDirectory / "Model2.so"));
+
+  ASSERT_EQ(0, cache.restore("key2", otherCompileDirectory));
+}
+
+TEST(CompilationCache, evict) {
+  const auto &testDir = dfl::test::testDirectory("TestCompilationCacheEvict");
+  dfl::outputs::CompilationCache cache(testDir / "cache", 20);
+  const auto &compileDirectory = testDir / "C1" / "outputs" / "compilation";
+  dfl::test::writeFile(compileDirectory / "Model.so", "0123456789");
+  cache.store("key1", compileDirectory);
+  cache.store("key2", compileDirectory);
+
+  // the use of the first entry is more recent than the store of the second one
+  for (const auto &entry : boost::filesystem::directory_iterator(testDir / "cache")) {
+    if (boost::filesystem::is_directory(entry.path())) {
+      boost::filesystem::last_write_time(entry.path(), std::time(nullptr) - 100);
+    }
+  }
+  const auto &restoredDirectory = testDir / "C2" / "outputs" / "compilation";
+  ASSERT_EQ(1, cache.restore("key1", restoredDirectory));
+  boost::filesystem::remove_all(restoredDirectory);
+  cache.store("key3", compileDirectory);
+  cache.evict();
+
+  ASSERT_EQ(1, cache.restore("key1", restoredDirectory));
+  boost::filesystem::remove_all(restoredDirectory);
+  ASSERT_EQ(0, cache.restore("key2", restoredDirectory));
+  ASSERT_EQ(1, cache.restore("key3", restoredDirectory));
+}
@@ -0,0 +1,128 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "ContingenciesArchive.h"
+#include "Log.h"
+#include "OutputsConstants.h"
+#include "Tests.h"
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <gtest_dynawo.h>
+
+static void createFile(const boost::filesystem::path &outputDir, const std::string &relativePath, const std::string &content) {
+  dfl::test::writeFile(outputDir / relativePath, content);
+}
+
+TEST(ContingenciesArchive, writeAndExtract) {
+  boost::filesystem::path outputDir(outputPathResults);
+  outputDir.append("TestContingenciesArchive");
+  boost::filesystem::remove_all(outputDir);
+  boost::filesystem::create_directories(outputDir);
+
+  createFile(outputDir, "TestArchive-C1.dyd", "dyd C1");
+  createFile(outputDir, "TestArchive-C1.par", "par C1");
+  createFile(outputDir, "timeLine/timeline_C1.xml", "timeline C1");
+  createFile(outputDir, "constraints/constraints_C1.xml", "constraints C1");
+  createFile(outputDir, "C1/outputs/finalState/outputIIDM.xml", "final state C1");
+  createFile(outputDir, "TestArchive-C1_bis.dyd", "dyd C1_bis");
+  createFile(outputDir, "timeLine/timeline_C1_bis.xml", "timeline C1_bis");
+  createFile(outputDir, "Network.par", "network");
+
+  dfl::outputs::ContingenciesArchive archiveWriter(
+      dfl::outputs::ContingenciesArchive::ContingenciesArchiveDefinition("TestArchive", outputDir, {"C1", "C1_bis"}, true));
+  archiveWriter.write();
+
+  boost::filesystem::path archivePath(outputDir);
+  archivePath.append(dfl::outputs::constants::contingenciesArchiveFileName);
+  ASSERT_TRUE(boost::filesystem::exists(archivePath));
+  // archived files are removed, other files are kept
+  ASSERT_FALSE(boost::filesystem::exists(outputDir / "TestArchive-C1.dyd"));
+  ASSERT_FALSE(boost::filesystem::exists(outputDir / "timeLine/timeline_C1_bis.xml"));
+  ASSERT_FALSE(boost::filesystem::exists(outputDir / "C1"));
+  ASSERT_TRUE(boost::filesystem::exists(outputDir / "Network.par"));
+
+  boost::filesystem::path extractDir(outputPathResults);
+  extractDir.append("TestContingenciesArchiveExtract");
+  boost::filesystem::remove_all(extractDir);
+  auto files = dfl::outputs::ContingenciesArchive::extract(archivePath, "C1", extractDir);
+  ASSERT_EQ(files.size(), 5u);
+  ASSERT_EQ(dfl::test::readFile(extractDir / "TestArchive-C1.dyd"), "dyd C1");
+  ASSERT_EQ(dfl::test::readFile(extractDir / "TestArchive-C1.par"), "par C1");
+  ASSERT_EQ(dfl::test::readFile(extractDir / "timeLine/timeline_C1.xml"), "timeline C1");
+  ASSERT_EQ(dfl::test::readFile(extractDir / "constraints/constraints_C1.xml"), "constraints C1");
+  ASSERT_EQ(dfl::test::readFile(extractDir / "C1/outputs/finalState/outputIIDM.xml"), "final state C1");
+  ASSERT_FALSE(boost::filesystem::exists(extractDir / "TestArchive-C1_bis.dyd"));
+
+  ASSERT_THROW_DYNAWO(dfl::outputs::ContingenciesArchive::extract(archivePath, "C2", extractDir), DYN::Error::GENERAL,
+                      dfl::KeyError_t::SAArchiveContingencyNotFound);
+}
+
+TEST(ContingenciesArchive, extractWithIndex) {
+  boost::filesystem::path outputDir(outputPathResults);
+  outputDir.append("TestContingenciesArchiveIndex");
+  boost::filesystem::remove_all(outputDir);
+  boost::filesystem::create_directories(outputDir);
+
+  std::vector<std::string> contingencyIds;
+  for (unsigned int i = 0; i < 20; ++i) {
+    const std::string &id = "C" + std::to_string(i);
+    contingencyIds.push_back(id);
+    createFile(outputDir, "TestArchive-" + id + ".dyd", "dyd " + id);
+    createFile(outputDir, id + "/outputs/logs/dynawo.log", std::string(10000 + i, 'a'));
+  }
+  dfl::outputs::ContingenciesArchive archiveWriter(
+      dfl::outputs::ContingenciesArchive::ContingenciesArchiveDefinition("TestArchive", outputDir, contingencyIds, false));
+  archiveWriter.write();
+  boost::filesystem::path archivePath(outputDir);
+  archivePath.append(dfl::outputs::constants::contingenciesArchiveFileName);
+
+  // the files of each contingency are found from the offset given by the index
+  for (const auto &id : {"C19", "C0", "C7"}) {
+    boost::filesystem::path extractDir(outputPathResults);
+    extractDir.append("TestContingenciesArchiveIndexExtract");
+    boost::filesystem::remove_all(extractDir);
+    auto files = dfl::outputs::ContingenciesArchive::extract(archivePath, id, extractDir);
+    ASSERT_EQ(files.size(), 2u);
+    ASSERT_EQ(dfl::test::readFile(extractDir / ("TestArchive-" + std::string(id) + ".dyd")), "dyd " + std::string(id));
+    ASSERT_EQ(dfl::test::readFile(outputDir / id / "outputs/logs/dynawo.log"), dfl::test::readFile(extractDir / id / "outputs/logs/dynawo.log"));
+  }
+}
+
+TEST(ContingenciesArchive, extractOutsideDestination) {
+  boost::filesystem::path outputDir(outputPathResults);
+  outputDir.append("TestContingenciesArchiveZipSlip");
+  boost::filesystem::remove_all(outputDir);
+  boost::filesystem::create_directories(outputDir);
+  createFile(outputDir, "C1/zz/bb.txt", "content");
+  dfl::outputs::ContingenciesArchive archiveWriter(
+      dfl::outputs::ContingenciesArchive::ContingenciesArchiveDefinition("TestArchive", outputDir, {"C1"}, false));
+  archiveWriter.write();
+  boost::filesystem::path archivePath(outputDir);
+  archivePath.append(dfl::outputs::constants::contingenciesArchiveFileName);
+
+  // the entry is renamed in the headers of the archive, as a crafted archive would name it
+  std::string content = dfl::test::readFile(archivePath);
+  const std::string name = "C1/C1/zz/bb.txt";
+  const std::string craftedName = "C1/../../bb.txt";
+  for (auto pos = content.find(name); pos != std::string::npos; pos = content.find(name, pos)) {
+    content.replace(pos, name.size(), craftedName);
+  }
+  {
+    std::ofstream ofs(archivePath.generic_string(), std::ios::binary);
+    ofs << content;
+  }
+
+  boost::filesystem::path extractDir(outputDir);
+  extractDir.append("extract");
+  ASSERT_THROW_DYNAWO(dfl::outputs::ContingenciesArchive::extract(archivePath, "C1", extractDir), DYN::Error::GENERAL,
+                      dfl::KeyError_t::SAArchiveInvalidEntry);
+  ASSERT_FALSE(boost::filesystem::exists(extractDir.parent_path().parent_path() / "bb.txt"));
+}
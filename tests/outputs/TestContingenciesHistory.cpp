@@ -0,0 +1,95 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "ContingenciesHistory.h"
+#include "OutputsConstants.h"
+#include "Tests.h"
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+
+static boost::filesystem::path historyPath(const std::string &testName) {
+  boost::filesystem::path outputDir(outputPathResults);
+  outputDir.append(testName);
+  boost::filesystem::remove_all(outputDir);
+  outputDir.append(dfl::outputs::constants::contingenciesHistoryFileName);
+  return outputDir;
+}
+
+TEST(ContingenciesHistory, appendAndRead) {
+  const auto &filepath = historyPath("TestContingenciesHistory");
+  dfl::outputs::ContingenciesHistory history(filepath);
+  ASSERT_TRUE(history.read().empty());
+
+  history.append({{1650000000, "LINE1", "0123456789abcdef", "CONVERGENCE", 1.25}, {1650000000, "GEN1", "fedcba9876543210", "DIVERGENCE", -1.}});
+  history.append({{1650000100, "LINE1", "0123456789abcdef", "EXECUTION_PROBLEM", 0.5}});
+
+  const auto &records = history.read();
+  ASSERT_EQ(3, records.size());
+  ASSERT_EQ(1650000000, records[0].timestamp);
+  ASSERT_EQ("LINE1", records[0].contingencyId);
+  ASSERT_EQ("0123456789abcdef", records[0].fingerprint);
+  ASSERT_EQ("CONVERGENCE", records[0].status);
+  ASSERT_DOUBLE_EQ(1.25, records[0].wallTime);
+  ASSERT_EQ("GEN1", records[1].contingencyId);
+  ASSERT_EQ("DIVERGENCE", records[1].status);
+  ASSERT_LT(records[1].wallTime, 0.);
+  ASSERT_EQ(1650000100, records[2].timestamp);
+  ASSERT_EQ("EXECUTION_PROBLEM", records[2].status);
+  ASSERT_DOUBLE_EQ(0.5, records[2].wallTime);
+}
+
+TEST(ContingenciesHistory, truncatedRecord) {
+  const auto &filepath = historyPath("TestContingenciesHistoryTruncated");
+  dfl::outputs::ContingenciesHistory history(filepath);
+  history.append({{1650000000, "LINE1", "0123456789abcdef", "CONVERGENCE", 1.25}, {1650000000, "GEN1", "fedcba9876543210", "DIVERGENCE", 2.}});
+
+  // interrupted write of the last record
+  boost::filesystem::resize_file(filepath, boost::filesystem::file_size(filepath) - 3);
+  const auto &records = history.read();
+  ASSERT_EQ(1, records.size());
+  ASSERT_EQ("LINE1", records[0].contingencyId);
+
+  // the truncated record is dropped by the next run
+  history.append({{1650000100, "GEN1", "fedcba9876543210", "CONVERGENCE", 3.}});
+  const auto &appended = history.read();
+  ASSERT_EQ(2, appended.size());
+  ASSERT_EQ("LINE1", appended[0].contingencyId);
+  ASSERT_EQ("CONVERGENCE", appended[0].status);
+  ASSERT_DOUBLE_EQ(1.25, appended[0].wallTime);
+  ASSERT_EQ(1650000100, appended[1].timestamp);
+  ASSERT_EQ("GEN1", appended[1].contingencyId);
+  ASSERT_EQ("CONVERGENCE", appended[1].status);
+  ASSERT_DOUBLE_EQ(3., appended[1].wallTime);
+}
+
+TEST(ContingenciesHistory, truncatedHeader) {
+  const auto &filepath = historyPath("TestContingenciesHistoryTruncatedHeader");
+  boost::filesystem::create_directories(filepath.parent_path());
+  std::ofstream ofs(filepath.generic_string(), std::ios::binary);
+  ofs << "DFLH";
+  ofs.close();
+
+  dfl::outputs::ContingenciesHistory history(filepath);
+  history.append({{1650000000, "LINE1", "0123456789abcdef", "CONVERGENCE", 1.25}});
+  const auto &records = history.read();
+  ASSERT_EQ(1, records.size());
+  ASSERT_EQ("LINE1", records[0].contingencyId);
+}
+
+TEST(ContingenciesHistory, notAHistory) {
+  const auto &filepath = historyPath("TestContingenciesHistoryInvalid");
+  boost::filesystem::create_directories(filepath.parent_path());
+  std::ofstream ofs(filepath.generic_string());
+  ofs << "{\"contingencies\": []}";
+  ofs.close();
+
+  ASSERT_THROW_DYNAWO(dfl::outputs::ContingenciesHistory(filepath).read(), DYN::Error::GENERAL, dfl::KeyError_t::SAHistoryReadError);
+}
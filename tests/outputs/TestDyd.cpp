@@ -28,6 +28,10 @@ using dfl::algo::HVDCLineDefinitions;
 using dfl::algo::LoadDefinition;
 using dfl::algo::StaticVarCompensatorDefinition;
 
+// writers keep references on the definitions: empty lists must outlive them
+static const std::vector<LoadDefinition> noLoads;
+static const std::vector<StaticVarCompensatorDefinition> noSVarCs;
+
 TEST(Dyd, write) {
   std::string basename = "TestDyd";
   std::string filename = basename + ".dyd";
@@ -63,7 +67,7 @@ TEST(Dyd, write) {
 
   outputPath.append(filename);
   dfl::outputs::Dyd dydWriter(
-      dfl::outputs::Dyd::DydDefinition(basename, outputPath.generic_string(), generators, loads, node, noHvdcDefs, noBuses, manager, noModels, {}));
+      dfl::outputs::Dyd::DydDefinition(basename, outputPath.generic_string(), generators, loads, node, noHvdcDefs, noBuses, manager, noModels, noSVarCs));
 
   dydWriter.write();
 
@@ -105,8 +109,8 @@ TEST(Dyd, writeRemote) {
                                                                                      {bus2, dfl::inputs::NetworkManager::NbOfRegulating::MULTIPLES}};
 
   outputPath.append(filename);
-  dfl::outputs::Dyd dydWriter(dfl::outputs::Dyd::DydDefinition(basename, outputPath.generic_string(), generators, {}, node, noHvdcDefs,
-                                                               busesRegulatedBySeveralGenerators, manager, noModels, {}));
+  dfl::outputs::Dyd dydWriter(dfl::outputs::Dyd::DydDefinition(basename, outputPath.generic_string(), generators, noLoads, node, noHvdcDefs,
+                                                               busesRegulatedBySeveralGenerators, manager, noModels, noSVarCs));
 
   dydWriter.write();
 
@@ -148,7 +152,7 @@ TEST(Dyd, writeHvdc) {
 
   outputPath.append(filename);
   dfl::outputs::Dyd dydWriter(
-      dfl::outputs::Dyd::DydDefinition(basename, outputPath.generic_string(), {}, {}, node, hvdcDefs, busesToNumberOfRegulationMap, manager, noModels, {}));
+      dfl::outputs::Dyd::DydDefinition(basename, outputPath.generic_string(), {}, noLoads, node, hvdcDefs, busesToNumberOfRegulationMap, manager, noModels, noSVarCs));
 
   dydWriter.write();
 
@@ -240,7 +244,7 @@ TEST(Dyd, writeDynamicModel) {
 
   outputPath.append(filename);
   dfl::outputs::Dyd dydWriter(
-      dfl::outputs::Dyd::DydDefinition(basename, outputPath.generic_string(), generators, loads, node, hvdcDefs, noBuses, manager, models, {}));
+      dfl::outputs::Dyd::DydDefinition(basename, outputPath.generic_string(), generators, loads, node, hvdcDefs, noBuses, manager, models, noSVarCs));
 
   dydWriter.write();
 
@@ -288,7 +292,7 @@ TEST(Dyd, writeStaticVarCompensator) {
 
   outputPath.append(filename);
   dfl::outputs::Dyd dydWriter(
-      dfl::outputs::Dyd::DydDefinition(basename, outputPath.generic_string(), {}, {}, node, noHvdcDefs, noBuses, manager, noModels, svarcs));
+      dfl::outputs::Dyd::DydDefinition(basename, outputPath.generic_string(), {}, noLoads, node, noHvdcDefs, noBuses, manager, noModels, svarcs));
 
   dydWriter.write();
 
@@ -324,7 +328,7 @@ TEST(Dyd, writeLoad) {
 
   outputPath.append(filename);
   dfl::outputs::Dyd dydWriter(
-      dfl::outputs::Dyd::DydDefinition(basename, outputPath.generic_string(), {}, loads, node, noHvdcDefs, noBuses, manager, noModels, {}));
+      dfl::outputs::Dyd::DydDefinition(basename, outputPath.generic_string(), {}, loads, node, noHvdcDefs, noBuses, manager, noModels, noSVarCs));
 
   dydWriter.write();
 
@@ -371,7 +375,7 @@ TEST(Dyd, writeVRRemote) {
 
   outputPath.append(filename);
   dfl::outputs::Dyd dydWriter(
-      dfl::outputs::Dyd::DydDefinition(basename, outputPath.generic_string(), {}, {}, node, hvdcDefs, busesToNumberOfRegulationMap, manager, noModels, {}));
+      dfl::outputs::Dyd::DydDefinition(basename, outputPath.generic_string(), {}, noLoads, node, hvdcDefs, busesToNumberOfRegulationMap, manager, noModels, noSVarCs));
 
   dydWriter.write();
 
@@ -0,0 +1,26 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "IndexedNames.h"
+#include "Tests.h"
+
+TEST(IndexedNames, names) {
+  dfl::outputs::IndexedNames names("secondaryVoltageControl_P0Pu_");
+  ASSERT_EQ(names.prefix(), "secondaryVoltageControl_P0Pu_");
+  ASSERT_EQ(names[0], "secondaryVoltageControl_P0Pu_0_");
+  // the indexes may be requested in any order
+  ASSERT_EQ(names[12], "secondaryVoltageControl_P0Pu_12_");
+  ASSERT_EQ(names[3], "secondaryVoltageControl_P0Pu_3_");
+
+  // the names are built once
+  const std::string *name = &names[5];
+  ASSERT_EQ(&names[5], name);
+  ASSERT_EQ(*name, "secondaryVoltageControl_P0Pu_5_");
+}
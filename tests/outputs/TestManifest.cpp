@@ -0,0 +1,125 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "Manifest.h"
+#include "OutputsConstants.h"
+#include "Tests.h"
+
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <fstream>
+#include <map>
+
+static std::map<std::string, std::string> readStatuses(const boost::filesystem::path &outputDir) {
+  boost::filesystem::path manifestPath(outputDir);
+  manifestPath.append(dfl::outputs::constants::manifestFileName);
+  boost::property_tree::ptree tree;
+  boost::property_tree::read_json(manifestPath.generic_string(), tree);
+  std::map<std::string, std::string> statuses;
+  for (const auto &file : tree.get_child("files")) {
+    statuses[file.second.get<std::string>("file")] = file.second.get<std::string>("status");
+  }
+  return statuses;
+}
+
+static void touch(const boost::filesystem::path &filepath) {
+  std::ofstream ofs(filepath.generic_string());
+  ofs << "content";
+}
+
+TEST(Manifest, incremental) {
+  boost::filesystem::path outputDir(outputPathResults);
+  outputDir.append("TestManifest");
+  boost::filesystem::remove_all(outputDir);
+  boost::filesystem::create_directories(outputDir);
+
+  boost::filesystem::path unchangedFile(outputDir);
+  unchangedFile.append("unchanged.par");
+  boost::filesystem::path changedFile(outputDir);
+  changedFile.append("changed.par");
+  boost::filesystem::path removedFile(outputDir);
+  removedFile.append("removed.par");
+  boost::filesystem::path newFile(outputDir);
+  newFile.append("new.par");
+
+  {
+    dfl::outputs::Manifest manifest(outputDir, true);
+    ASSERT_TRUE(manifest.update(unchangedFile, "1"));
+    ASSERT_TRUE(manifest.update(changedFile, "2"));
+    ASSERT_TRUE(manifest.update(removedFile, "3"));
+    touch(unchangedFile);
+    touch(changedFile);
+    touch(removedFile);
+    manifest.write();
+  }
+  auto statuses = readStatuses(outputDir);
+  ASSERT_EQ(statuses.size(), 3u);
+  ASSERT_EQ(statuses.at("unchanged.par"), "NEW");
+
+  boost::filesystem::remove(removedFile);
+  {
+    dfl::outputs::Manifest manifest(outputDir, true);
+    ASSERT_FALSE(manifest.update(unchangedFile, "1"));
+    ASSERT_TRUE(manifest.update(changedFile, "22"));
+    ASSERT_TRUE(manifest.update(removedFile, "3"));
+    ASSERT_TRUE(manifest.update(newFile, "4"));
+    ASSERT_EQ(manifest.fingerprint(changedFile), "22");
+    ASSERT_TRUE(manifest.fingerprint(outputDir / "unknown.par").empty());
+    manifest.write();
+  }
+  statuses = readStatuses(outputDir);
+  ASSERT_EQ(statuses.size(), 4u);
+  ASSERT_EQ(statuses.at("unchanged.par"), "UNCHANGED");
+  ASSERT_EQ(statuses.at("changed.par"), "CHANGED");
+  ASSERT_EQ(statuses.at("removed.par"), "UNCHANGED");
+  ASSERT_EQ(statuses.at("new.par"), "NEW");
+
+  // without incremental export, all files are written but their status is still reported
+  {
+    dfl::outputs::Manifest manifest(outputDir, false);
+    ASSERT_TRUE(manifest.update(unchangedFile, "1"));
+    manifest.write();
+  }
+  statuses = readStatuses(outputDir);
+  ASSERT_EQ(statuses.at("unchanged.par"), "UNCHANGED");
+}
+
+TEST(Manifest, disabled) {
+  boost::filesystem::path outputDir(outputPathResults);
+  outputDir.append("TestManifestDisabled");
+  boost::filesystem::remove_all(outputDir);
+  boost::filesystem::create_directories(outputDir);
+  boost::filesystem::path file(outputDir);
+  file.append("file.par");
+  touch(file);
+
+  dfl::outputs::Manifest manifest;
+  ASSERT_TRUE(manifest.update(file, "1"));
+  ASSERT_TRUE(manifest.update(file, "1"));
+  manifest.write();
+
+  boost::filesystem::path manifestPath(outputDir);
+  manifestPath.append(dfl::outputs::constants::manifestFileName);
+  ASSERT_FALSE(boost::filesystem::exists(manifestPath));
+}
+
+TEST(Manifest, fingerprintOfFile) {
+  boost::filesystem::path outputDir(outputPathResults);
+  outputDir.append("TestManifestFile");
+  boost::filesystem::remove_all(outputDir);
+  boost::filesystem::create_directories(outputDir);
+  boost::filesystem::path file(outputDir);
+  file.append("file.par");
+  touch(file);
+
+  dfl::outputs::Manifest manifest(outputDir, false);
+  manifest.updateWritten(file);
+  ASSERT_EQ(dfl::common::Fingerprint::ofFile(file), manifest.fingerprint(file));
+}
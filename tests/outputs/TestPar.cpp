@@ -28,6 +28,10 @@ using dfl::algo::HVDCLineDefinitions;
 using dfl::algo::LoadDefinition;
 using dfl::algo::StaticVarCompensatorDefinition;
 
+// writers keep references on the definitions: empty lists must outlive them
+static const std::vector<LoadDefinition> noLoads;
+static const std::vector<StaticVarCompensatorDefinition> noSVarCs;
+
 TEST(TestPar, write) {
   dfl::inputs::DynamicDataBaseManager manager("", "");
 
@@ -51,7 +55,9 @@ TEST(TestPar, write) {
       GeneratorDefinition("G7", GeneratorDefinition::ModelType::PROP_SIGNALN_RECTANGULAR, "04", {}, 3., 30., -33., 330., 0, 0, bus1),
       GeneratorDefinition("G8", GeneratorDefinition::ModelType::SIGNALN_TFO_RECTANGULAR, "04", {}, 3., 30., -33., 330., 0, 0, bus1),
       GeneratorDefinition("G9", GeneratorDefinition::ModelType::SIGNALN_TFO_RECTANGULAR, "04", {}, 3., 30., -33., 330., 0, 0, bus1, true),
-      GeneratorDefinition("G10", GeneratorDefinition::ModelType::DIAGRAM_PQ_TFO_SIGNALN, "04", {}, 3., 30., -33., 330., 0, 0, bus1)};
+      GeneratorDefinition("G10", GeneratorDefinition::ModelType::DIAGRAM_PQ_TFO_SIGNALN, "04", {}, 3., 30., -33., 330., 0, 0, bus1),
+      // same parameters as G8: both generators share a single parameter set
+      GeneratorDefinition("G11", GeneratorDefinition::ModelType::SIGNALN_TFO_RECTANGULAR, "04", {}, 3., 30., -33., 330., 0, 0, bus1)};
 
   HVDCLineDefinitions noHvdcDefs;
   dfl::inputs::NetworkManager::BusMapRegulating busesToNumberOfRegulationMap = {{bus1, dfl::inputs::NetworkManager::NbOfRegulating::MULTIPLES}};
@@ -60,7 +66,7 @@ TEST(TestPar, write) {
   outputPath.append(filename);
   dfl::inputs::Configuration config("res/config_activepowercompensation_p.json");
   dfl::outputs::Par parWriter(dfl::outputs::Par::ParDefinition(basename, config, outputPath.generic_string(), generators, noHvdcDefs,
-                                                               busesToNumberOfRegulationMap, manager, {}, noModels, {}, {}, {}, {}));
+                                                               busesToNumberOfRegulationMap, manager, {}, noModels, {}, {}, noSVarCs, noLoads));
 
   parWriter.write();
 
@@ -104,7 +110,7 @@ TEST(TestPar, writeRemote) {
   outputPath.append(filename);
   dfl::inputs::Configuration config("res/config_activepowercompensation_p.json");
   dfl::outputs::Par parWriter(dfl::outputs::Par::ParDefinition(basename, config, outputPath.generic_string(), generators, noHvdcDefs,
-                                                               busesToNumberOfRegulationMap, manager, {}, noModels, {}, {}, {}, {}));
+                                                               busesToNumberOfRegulationMap, manager, {}, noModels, {}, {}, noSVarCs, noLoads));
 
   parWriter.write();
 
@@ -175,7 +181,7 @@ TEST(TestPar, writeHdvc) {
   outputPath.append(filename);
   dfl::inputs::Configuration config("res/config_activepowercompensation_p.json");
   dfl::outputs::Par parWriter(dfl::outputs::Par::ParDefinition(basename, config, outputPath.generic_string(), {}, hvdcDefs, busesToNumberOfRegulationMap,
-                                                               manager, {}, noModels, {}, {}, {}, {}));
+                                                               manager, {}, noModels, {}, {}, noSVarCs, noLoads));
 
   parWriter.write();
 
@@ -289,7 +295,7 @@ TEST(TestPar, DynModel) {
   tfosById.tfosMap.insert({"TFOId", *tfo});
   tfosById.tfosMap.insert({"TFOId2", *tfo});
   dfl::outputs::Par parWriter(dfl::outputs::Par::ParDefinition(basename, config, outputPath.generic_string(), generators, hvdcDefs, noBuses, manager, counters,
-                                                               defs, {}, tfosById, {}, {}));
+                                                               defs, {}, tfosById, noSVarCs, noLoads));
   parWriter.write();
 
   boost::filesystem::path reference("reference");
@@ -335,7 +341,7 @@ TEST(TestPar, writeStaticVarCompensator) {
   outputPath.append(filename);
   dfl::inputs::Configuration config("res/config_activepowercompensation_p.json");
   dfl::outputs::Par parWriter(
-      dfl::outputs::Par::ParDefinition(basename, config, outputPath.generic_string(), {}, noHvdcDefs, noBuses, manager, {}, noModels, {}, {}, svarcs, {}));
+      dfl::outputs::Par::ParDefinition(basename, config, outputPath.generic_string(), {}, noHvdcDefs, noBuses, manager, {}, noModels, {}, {}, svarcs, noLoads));
 
   parWriter.write();
 
@@ -373,7 +379,7 @@ TEST(TestPar, writeLoad) {
   outputPath.append(filename);
   dfl::inputs::Configuration config("res/config_activepowercompensation_p.json");
   dfl::outputs::Par parWriter(
-      dfl::outputs::Par::ParDefinition(basename, config, outputPath.generic_string(), {}, noHvdcDefs, noBuses, manager, {}, noModels, {}, {}, {}, loads));
+      dfl::outputs::Par::ParDefinition(basename, config, outputPath.generic_string(), {}, noHvdcDefs, noBuses, manager, {}, noModels, {}, {}, noSVarCs, loads));
 
   parWriter.write();
 
@@ -422,7 +428,7 @@ TEST(TestPar, writeVRRemote) {
   outputPath.append(filename);
   dfl::inputs::Configuration config("res/config_activepowercompensation_p.json");
   dfl::outputs::Par parWriter(dfl::outputs::Par::ParDefinition(basename, config, outputPath.generic_string(), generators, hvdcDefs,
-                                                               busesToNumberOfRegulationMap, manager, {}, noModels, {}, {}, {}, {}));
+                                                               busesToNumberOfRegulationMap, manager, {}, noModels, {}, {}, noSVarCs, noLoads));
 
   parWriter.write();
 
@@ -0,0 +1,85 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "OutputsConstants.h"
+#include "ProgressJournal.h"
+#include "Tests.h"
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+
+static boost::filesystem::path journalPath(const std::string &testName) {
+  boost::filesystem::path outputDir(outputPathResults);
+  outputDir.append(testName);
+  boost::filesystem::remove_all(outputDir);
+  outputDir.append(dfl::outputs::constants::progressJournalFileName);
+  return outputDir;
+}
+
+TEST(ProgressJournal, resume) {
+  const auto &filepath = journalPath("TestProgressJournal");
+  {
+    dfl::outputs::ProgressJournal journal(filepath, true);
+    ASSERT_TRUE(journal.previousEntries().empty());
+    journal.append({"LINE1", "0123456789abcdef", "CONVERGENCE", 1.25, "LINE1"});
+    journal.append({"GEN1", "fedcba9876543210", "DIVERGENCE", 0.1, "GEN1", 2});
+    journal.append({"LINE1", "0123456789abcdee", "EXECUTION_PROBLEM", 2., "LINE1"});
+  }
+
+  {
+    dfl::outputs::ProgressJournal journal(filepath, true);
+    const auto &entries = journal.previousEntries();
+    ASSERT_EQ(2, entries.size());
+    // the last entry of a contingency prevails
+    ASSERT_EQ("0123456789abcdee", entries.at("LINE1").fingerprint);
+    ASSERT_EQ("EXECUTION_PROBLEM", entries.at("LINE1").status);
+    ASSERT_DOUBLE_EQ(2., entries.at("LINE1").wallTime);
+    ASSERT_EQ("DIVERGENCE", entries.at("GEN1").status);
+    ASSERT_DOUBLE_EQ(0.1, entries.at("GEN1").wallTime);
+    ASSERT_EQ("GEN1", entries.at("GEN1").resultDir);
+    ASSERT_EQ(2, entries.at("GEN1").solverProfile);
+    ASSERT_EQ(0, entries.at("LINE1").solverProfile);
+  }
+
+  // without resume, the journal is started over
+  {
+    dfl::outputs::ProgressJournal journal(filepath, false);
+    ASSERT_TRUE(journal.previousEntries().empty());
+  }
+  dfl::outputs::ProgressJournal journal(filepath, true);
+  ASSERT_TRUE(journal.previousEntries().empty());
+}
+
+TEST(ProgressJournal, truncatedLine) {
+  const auto &filepath = journalPath("TestProgressJournalTruncated");
+  {
+    dfl::outputs::ProgressJournal journal(filepath, false);
+    journal.append({"LINE1", "0123456789abcdef", "CONVERGENCE", 1.25, "LINE1"});
+  }
+  {
+    // interrupted write of an entry
+    std::ofstream ofs(filepath.generic_string(), std::ios::app);
+    // entry written without solver profile
+    ofs << "LOAD1\t0123456789abcdef\tDIVERGENCE\t3\tLOAD1\n";
+    ofs << "GEN1\tfedcba9876543210\tCONV";
+  }
+
+  {
+    dfl::outputs::ProgressJournal journal(filepath, true);
+    ASSERT_EQ(2, journal.previousEntries().size());
+    ASSERT_EQ(1, journal.previousEntries().count("LINE1"));
+    ASSERT_EQ(0, journal.previousEntries().at("LOAD1").solverProfile);
+    journal.append({"GEN1", "fedcba9876543210", "CONVERGENCE", 0.5, "GEN1"});
+  }
+
+  dfl::outputs::ProgressJournal journal(filepath, true);
+  ASSERT_EQ(3, journal.previousEntries().size());
+  ASSERT_EQ("CONVERGENCE", journal.previousEntries().at("GEN1").status);
+}
@@ -0,0 +1,66 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "ResultCache.h"
+#include "Tests.h"
+
+#include <boost/filesystem.hpp>
+#include <ctime>
+
+TEST(ResultCache, storeAndRestore) {
+  const auto &testDir = dfl::test::testDirectory("TestResultCache");
+  dfl::outputs::ResultCache cache(testDir / "cache", 1024 * 1024);
+  const auto &workingDirectory = testDir / "outputs" / "C1";
+  dfl::test::writeFile(workingDirectory / "outputs" / "logs" / "dynawo.log", "log");
+  dfl::test::writeFile(workingDirectory / "outputs" / "finalState" / "outputIIDM.xml", "iidm");
+
+  dfl::outputs::ResultCache::Result result;
+  ASSERT_FALSE(cache.restore("key1", workingDirectory, result));
+  cache.store("key1", workingDirectory, {"CONVERGENCE", 2.5, 1});
+  // an entry is stored only once
+  cache.store("key1", workingDirectory, {"DIVERGENCE", 1.});
+
+  boost::filesystem::remove_all(testDir / "outputs");
+  dfl::test::writeFile(workingDirectory / "stale.log", "stale");
+  ASSERT_TRUE(cache.restore("key1", workingDirectory, result));
+  ASSERT_EQ("CONVERGENCE", result.status);
+  ASSERT_DOUBLE_EQ(2.5, result.wallTime);
+  ASSERT_EQ(1, result.solverProfile);
+  ASSERT_EQ("log", dfl::test::readFile(workingDirectory / "outputs" / "logs" / "dynawo.log"));
+  ASSERT_EQ("iidm", dfl::test::readFile(workingDirectory / "outputs" / "finalState" / "outputIIDM.xml"));
+  ASSERT_FALSE(boost::filesystem::exists(workingDirectory / "stale.log"));
+  ASSERT_FALSE(cache.restore("key2", workingDirectory, result));
+}
+
+TEST(ResultCache, evictLeastRecentlyUsed) {
+  const auto &testDir = dfl::test::testDirectory("TestResultCacheEviction");
+  const auto &cacheDir = testDir / "cache";
+  const auto &workingDirectory = testDir / "outputs" / "C1";
+  dfl::test::writeFile(workingDirectory / "dynawo.log", std::string(100, 'a'));
+
+  dfl::outputs::ResultCache cache(cacheDir, 250);
+  cache.store("key1", workingDirectory, {"CONVERGENCE", 1.});
+  cache.store("key2", workingDirectory, {"CONVERGENCE", 1.});
+  cache.evict();
+
+  // the use of the first entry is more recent than the store of the second one
+  for (const auto &entry : boost::filesystem::directory_iterator(cacheDir)) {
+    boost::filesystem::last_write_time(entry.path() / "entry.json", std::time(nullptr) - 100);
+  }
+  dfl::outputs::ResultCache::Result result;
+  ASSERT_TRUE(cache.restore("key1", workingDirectory, result));
+  cache.store("key3", workingDirectory, {"DIVERGENCE", 1.});
+  cache.evict();
+
+  ASSERT_TRUE(cache.restore("key1", workingDirectory, result));
+  ASSERT_FALSE(cache.restore("key2", workingDirectory, result));
+  ASSERT_TRUE(cache.restore("key3", workingDirectory, result));
+  ASSERT_EQ("DIVERGENCE", result.status);
+}
@@ -47,3 +47,71 @@ TEST(SolverPar, write) {
   outputPath.append(dfl::outputs::constants::solverParFileName);
   dfl::test::checkFilesEqual(outputPath.generic_string(), reference.generic_string());
 }
+
+TEST(SolverPar, writeSA) {
+  const std::string basename = "TestSolverParSA";
+
+  dfl::inputs::Configuration config("res/config_solver_SA.json", dfl::inputs::Configuration::SimulationKind::SECURITY_ANALYSIS);
+  dfl::outputs::Solver solverWriter{dfl::outputs::Solver::SolverDefinition(config)};
+  boost::filesystem::path outputPath(outputPathResults);
+  outputPath.append(basename);
+  if (!boost::filesystem::exists(outputPath)) {
+    boost::filesystem::create_directories(outputPath);
+  }
+  solverWriter.write();
+  boost::filesystem::path reference("reference");
+  reference.append(basename);
+  reference.append(dfl::outputs::constants::solverParFileName);
+  outputPath.append(dfl::outputs::constants::solverParFileName);
+  dfl::test::checkFilesEqual(outputPath.generic_string(), reference.generic_string());
+}
+
+TEST(SolverPar, writeSAUnknownProfileParameter) {
+  dfl::inputs::Configuration config("res/config_solver_SA_unknown_profile.json", dfl::inputs::Configuration::SimulationKind::SECURITY_ANALYSIS);
+  dfl::outputs::Solver solverWriter{dfl::outputs::Solver::SolverDefinition(config)};
+  boost::filesystem::path outputPath(outputPathResults);
+  outputPath.append("TestSolverParSAUnknownProfile");
+  if (!boost::filesystem::exists(outputPath)) {
+    boost::filesystem::create_directories(outputPath);
+  }
+  ASSERT_THROW_DYNAWO(solverWriter.write(), DYN::Error::GENERAL, dfl::KeyError_t::SolverProfileUnknownParameter);
+}
+
+TEST(SolverPar, autoTune) {
+  using StartingPointMode = dfl::inputs::Configuration::StartingPointMode;
+  dfl::outputs::Solver::NetworkStatistics statistics;
+  statistics.nbBuses = 100;
+  statistics.nbRegulatingGenerators = 5;
+
+  // a small network keeps the default values
+  auto tuning = dfl::outputs::Solver::autoTune(statistics, StartingPointMode::WARM);
+  ASSERT_EQ(4, tuning.size());
+  ASSERT_DOUBLE_EQUALS_DYNAWO(15., tuning.at("mxiter"));
+  ASSERT_DOUBLE_EQUALS_DYNAWO(30., tuning.at("mxiterAlg"));
+  ASSERT_DOUBLE_EQUALS_DYNAWO(50., tuning.at("mxiterAlgJ"));
+  ASSERT_DOUBLE_EQUALS_DYNAWO(10., tuning.at("maxNewtonTry"));
+
+  tuning = dfl::outputs::Solver::autoTune(statistics, StartingPointMode::FLAT);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(100., tuning.at("mxiterAlgJ"));
+
+  statistics.nbBuses = 5000;
+  tuning = dfl::outputs::Solver::autoTune(statistics, StartingPointMode::WARM);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(20., tuning.at("mxiter"));
+  ASSERT_DOUBLE_EQUALS_DYNAWO(75., tuning.at("mxiterAlgJ"));
+  ASSERT_DOUBLE_EQUALS_DYNAWO(15., tuning.at("maxNewtonTry"));
+
+  statistics.nbBuses = 100000;
+  statistics.nbHvdcLines = 2;
+  tuning = dfl::outputs::Solver::autoTune(statistics, StartingPointMode::FLAT);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(25., tuning.at("mxiter"));
+  ASSERT_DOUBLE_EQUALS_DYNAWO(50., tuning.at("mxiterAlg"));
+  ASSERT_DOUBLE_EQUALS_DYNAWO(200., tuning.at("mxiterAlgJ"));
+  ASSERT_DOUBLE_EQUALS_DYNAWO(25., tuning.at("maxNewtonTry"));
+
+  // many regulating generators imply frequent mode changes
+  statistics.nbBuses = 100;
+  statistics.nbHvdcLines = 0;
+  statistics.nbRegulatingGenerators = 20;
+  tuning = dfl::outputs::Solver::autoTune(statistics, StartingPointMode::WARM);
+  ASSERT_DOUBLE_EQUALS_DYNAWO(15., tuning.at("maxNewtonTry"));
+}